@@ -0,0 +1,118 @@
+-- mGBA のスクリプト機能から読み込む（mgba-qt --script benchmark/bench.lua final.mb）
+-- BENCHMARK_BUILD でビルドしたゲームが毎フレーム書き出す FrameCounter::Publication を読み取り、CSVに記録する
+-- 数値はどのビルドを読み込ませたかで変わる、run.sh は RELEASE_BUILD（デバッグ盤面のシナリオは DEBUG_BOARD も）を付けてビルドする
+-- キー入力は src/host/ と同じ書式のスクリプトから与える
+--
+-- 環境変数:
+--   BENCH_INPUT   キー入力スクリプトのパス（省略時は入力なし）
+--   BENCH_FRAMES  計測するフレーム数（省略時 3600）
+--   BENCH_OUTPUT  出力するCSVのパス（省略時 bench.csv）
+
+local Magic0 = 0x52544554
+local Magic1 = 0x48434E42
+
+local WramBegin = 0x02000000
+local WramEnd = 0x02040000
+
+local KeyNames = {
+  A = 0x0001,
+  B = 0x0002,
+  SELECT = 0x0004,
+  START = 0x0008,
+  RIGHT = 0x0010,
+  LEFT = 0x0020,
+  UP = 0x0040,
+  DOWN = 0x0080,
+  R = 0x0100,
+  L = 0x0200,
+}
+
+
+local function LoadInputScript(path)
+  local events = {}
+  if not path then
+    return events
+  end
+
+  local file = assert(io.open(path, "r"), "cannot open input script " .. path)
+  local lineNumber = 0
+  for line in file:lines() do
+    lineNumber = lineNumber + 1
+    line = line:gsub("#.*", "")
+
+    local event = nil
+    for token in line:gmatch("%S+") do
+      if not event then
+        event = { frame = assert(tonumber(token), path .. ":" .. lineNumber .. ": invalid frame"), keys = 0 }
+      else
+        local key = assert(KeyNames[token], path .. ":" .. lineNumber .. ": unknown key " .. token)
+        event.keys = event.keys | key
+      end
+    end
+
+    if event then
+      assert(#events == 0 or events[#events].frame <= event.frame, path .. ":" .. lineNumber .. ": frames must be in ascending order")
+      events[#events + 1] = event
+    end
+  end
+  file:close()
+
+  return events
+end
+
+
+-- Publication は .data に置かれているので、起動直後からマジックナンバーが入っている
+local function FindPublication()
+  for address = WramBegin, WramEnd - 24, 4 do
+    if emu:read32(address) == Magic0 and emu:read32(address + 4) == Magic1 then
+      return address
+    end
+  end
+  return nil
+end
+
+
+local inputEvents = LoadInputScript(os.getenv("BENCH_INPUT"))
+local inputIndex = 1
+local numFrames = tonumber(os.getenv("BENCH_FRAMES") or "3600")
+local output = assert(io.open(os.getenv("BENCH_OUTPUT") or "bench.csv", "w"))
+
+local publication = nil
+local lastFrame = 0
+
+output:write("frame,cycles,root_scene,sub_scene\n")
+
+
+callbacks:add("frame", function()
+  if not publication then
+    publication = FindPublication()
+    if not publication then
+      return
+    end
+    console:log(string.format("bench: publication found at %08X", publication))
+  end
+
+  local frame = emu:read32(publication + 8)
+  if frame == lastFrame then
+    -- 1フレームに収まらなかった（VBlankを跨いだ）ので、まだ書き出されていない
+    return
+  end
+  lastFrame = frame
+
+  local cycles = emu:read32(publication + 12)
+  local rootScene = emu:read16(publication + 16)
+  local subScene = emu:read16(publication + 18)
+  output:write(string.format("%d,%d,%d,%d\n", frame, cycles, rootScene, subScene))
+
+  -- キー入力はエミュレータのフレームではなくゲームループの回数に合わせる（処理落ちしても入力がずれないように）
+  while inputIndex <= #inputEvents and inputEvents[inputIndex].frame <= frame do
+    emu:setKeys(inputEvents[inputIndex].keys)
+    inputIndex = inputIndex + 1
+  end
+
+  if frame >= numFrames then
+    output:close()
+    console:log(string.format("bench: %d frames recorded", frame))
+    os.exit(0)
+  end
+end)
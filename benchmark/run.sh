@@ -0,0 +1,55 @@
+#!/bin/bash
+# usage: benchmark/run.sh [max-percent]
+#
+# scenarios.txt の各シナリオを BENCHMARK_BUILD でビルドしたゲームで mGBA 上で実行し、
+# シーンごとの1フレームあたりのサイクル数（最小・平均・最大、1フレームに対する割合）を集計する
+# max-percent を指定すると、どこかのシーンの最大値がそれを超えたときに失敗する（回帰チェック用）
+#
+# 環境変数:
+#   MGBA        mGBA の実行ファイル（省略時 mgba-qt）、--script を受け付けるもの
+#   MGBA_FLAGS  mGBA に追加で渡すオプション（例: "-C fpsTarget=100000" で等速制限を外す）
+#
+# ウィンドウのない環境では QT_QPA_PLATFORM=offscreen を指定する
+
+set -e
+
+cd "$(dirname "$0")/.."
+
+MGBA=${MGBA:-mgba-qt}
+OUT=build-benchmark
+
+mkdir -p ${OUT}/result
+
+build() {
+  local board=$1
+  local dir=${OUT}/${board}
+
+  if [ -e ${dir}/final.mb ]; then
+    return
+  fi
+
+  # どのシナリオもリリースビルドで計測する（デバッグビルドだと DbgPrintf やプロファイラの分まで数えてしまう）
+  mkdir -p ${dir}
+  if [ "${board}" = "None" ]; then
+    (cd ${dir} && cmake -DRELEASE_BUILD=ON -DBENCHMARK_BUILD=ON ../../src && make -j)
+  else
+    (cd ${dir} && cmake -DRELEASE_BUILD=ON -DBENCHMARK_BUILD=ON -DDEBUG_BOARD=${board} ../../src && make -j)
+  fi
+}
+
+results=()
+while read -r name board frames input; do
+  build ${board}
+
+  echo "bench: ${name}"
+  BENCH_INPUT=${input} BENCH_FRAMES=${frames} BENCH_OUTPUT=${OUT}/result/${name}.csv \
+    ${MGBA} ${MGBA_FLAGS} --script benchmark/bench.lua ${OUT}/${board}/final.mb < /dev/null
+
+  results+=(${OUT}/result/${name}.csv)
+done < <(grep -v -e '^#' -e '^\s*$' benchmark/scenarios.txt)
+
+if [ -n "$1" ]; then
+  node benchmark/summarize.js --max-percent $1 "${results[@]}"
+else
+  node benchmark/summarize.js "${results[@]}"
+fi
@@ -0,0 +1,133 @@
+const fs = require('fs');
+const path = require('path');
+
+
+// 1フレームのサイクル数（228ライン * 1232サイクル）
+const CyclesPerFrame = 280896;
+
+// app/SceneManager.hpp の Root::SceneId
+const RootSceneNames = [
+  'Config',
+  'GameTetra',
+  'GameTetraRestart',
+  'Title',
+];
+
+// app/Tetra/SceneManager.hpp の GameTetra::SceneId
+const SubSceneNames = [
+  'Game',
+  'GameClear',
+  'GameOver',
+  'GamePause',
+  'GameReady',
+];
+
+// FrameCounter::NoSubScene
+const NoSubScene = 0xFFFF;
+
+
+class Summarizer {
+  constructor() {
+    /**
+     * @type {Map<string, { scenario: string, scene: string, frames: number, min: number, max: number, sum: number, overruns: number }>}
+     */
+    this.stats = new Map();
+  }
+
+  /**
+   * @param {number} rootScene
+   * @param {number} subScene
+   * @returns {string}
+   */
+  static sceneName(rootScene, subScene) {
+    const root = RootSceneNames[rootScene] || `Root${rootScene}`;
+    if (subScene === NoSubScene) {
+      return root;
+    }
+    return `${root}/${SubSceneNames[subScene] || `Sub${subScene}`}`;
+  }
+
+  /**
+   * @param {string} csvFile output of bench.lua
+   */
+  addFile(csvFile) {
+    const scenario = path.basename(csvFile, path.extname(csvFile));
+    const lines = fs.readFileSync(csvFile, 'utf8').split(/\r?\n/).slice(1);
+    for (const line of lines) {
+      if (!line) {
+        continue;
+      }
+      const [, cycles, rootScene, subScene] = line.split(',').map(value => parseInt(value, 10));
+      this.add(scenario, '(all)', cycles);
+      this.add(scenario, Summarizer.sceneName(rootScene, subScene), cycles);
+    }
+  }
+
+  /**
+   * @param {string} scenario
+   * @param {string} scene
+   * @param {number} cycles
+   */
+  add(scenario, scene, cycles) {
+    const key = `${scenario}\t${scene}`;
+    if (!this.stats.has(key)) {
+      this.stats.set(key, { scenario, scene, frames: 0, min: Infinity, max: 0, sum: 0, overruns: 0 });
+    }
+    const stat = this.stats.get(key);
+    stat.frames++;
+    stat.min = Math.min(stat.min, cycles);
+    stat.max = Math.max(stat.max, cycles);
+    stat.sum += cycles;
+    if (cycles > CyclesPerFrame) {
+      stat.overruns++;
+    }
+  }
+
+  /**
+   * @returns {number} worst max cycles in percent of a frame
+   */
+  print() {
+    const percent = cycles => (cycles * 100 / CyclesPerFrame).toFixed(1);
+
+    const rows = [['scenario', 'scene', 'frames', 'min', 'avg', 'max', 'avg%', 'max%', 'overruns']];
+    let worst = 0;
+    for (const stat of this.stats.values()) {
+      const avg = Math.round(stat.sum / stat.frames);
+      rows.push([stat.scenario, stat.scene, stat.frames, stat.min, avg, stat.max, percent(avg), percent(stat.max), stat.overruns].map(String));
+      worst = Math.max(worst, stat.max * 100 / CyclesPerFrame);
+    }
+
+    const widths = rows[0].map((_, i) => Math.max(...rows.map(row => row[i].length)));
+    for (const row of rows) {
+      // 文字列の列は左寄せ、数値の列は右寄せ
+      console.log(row.map((cell, i) => i < 2 ? cell.padEnd(widths[i]) : cell.padStart(widths[i])).join('  '));
+    }
+
+    return worst;
+  }
+}
+
+
+// usage: node summarize.js [--max-percent N] result.csv...
+// --max-percent を指定すると、どこかのシーンの最大値が1フレームのN%を超えたときに終了コード1を返す
+const args = process.argv.slice(2);
+let maxPercent = null;
+const files = [];
+for (let i = 0; i < args.length; i++) {
+  if (args[i] === '--max-percent') {
+    maxPercent = parseFloat(args[++i]);
+  } else {
+    files.push(args[i]);
+  }
+}
+
+const summarizer = new Summarizer();
+for (const file of files) {
+  summarizer.addFile(file);
+}
+const worst = summarizer.print();
+
+if (maxPercent !== null && worst > maxPercent) {
+  console.error(`worst frame is ${worst.toFixed(1)}% of the frame budget (limit ${maxPercent}%)`);
+  process.exit(1);
+}
@@ -0,0 +1,8 @@
+#!/bin/bash
+
+rm -rf build-host
+mkdir build-host
+cd build-host
+
+cmake ../src/host
+make -j
@@ -9,26 +9,21 @@
 
 #include "GameConfig.hpp"
 #include "MergePalette.hpp"
+#include "VRAMLayout.hpp"
 
 
 namespace Root::Config {
-  constexpr auto MergedPaletteData = MergePalette(Tile::bg::PaletteData, Tile::bg_background::PaletteData);
+  // VRAMUploadQueue（DMA3 の32bit転送）で転送するので4バイト境界に置く
+  alignas(4) constexpr auto MergedPaletteData = MergePalette(Tile::bg::PaletteData, Tile::bg_background::PaletteData);
 
-  // 背景画像用でないBGタイルが512タイル以下しか消費していないことを確認する
-  // 背景画像用のタイルが0x06004000から配置されるため
-  static_assert(Tile::bg::TileData.size() * sizeof(Tile::bg::TileData[0]) <= 0x4000);
-
-  constexpr std::uint16_t CharBase    = 0;
-  constexpr std::uint16_t BG3CharBase = 1;
+  // 配置は VRAMLayout で決める
+  constexpr std::uint16_t CharBase    = VRAMLayout::BG::CharBaseBlock<VRAMLayout::BG::CommonTiles>;
+  constexpr std::uint16_t BG3CharBase = VRAMLayout::BG::CharBaseBlock<VRAMLayout::BG::BackgroundTiles>;
 
   namespace ScrBase {
-    // 0 ~ 7 are reserved for Tile 0
-    // 8 ~ 23 are reserved for Tile 1
-    // 24 is reserved for BG3
-
-    constexpr std::uint16_t BG0Title  = 25;
-    constexpr std::uint16_t BG0Config = 25;
-    constexpr std::uint16_t BG3       = 24;
+    constexpr std::uint16_t BG0Title  = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::TextMap>;
+    constexpr std::uint16_t BG0Config = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::TextMap>;
+    constexpr std::uint16_t BG3       = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::BackgroundMap>;
   }   // namespace ScrBase
 
   namespace Priority {
@@ -51,6 +46,16 @@ namespace Root::Config {
     constexpr unsigned int MenuTextScreenY = 4;
   }   // namespace Title
 
+#ifndef RELEASE_BUILD
+  namespace Profiler {
+    // 処理落ちしたフレームを DbgPrintf で知らせる
+    constexpr bool ReportOverrun = true;
+
+    // 0 以外なら、このフレーム数ごとに Profiler::Dump() を呼ぶ
+    constexpr unsigned int DumpInterval = 0;
+  }   // namespace Profiler
+#endif
+
   constexpr GameConfig DefaultConfig{
     GameConfig::Mode::Line150,
     GameConfig::Music::Tetris99,
@@ -19,77 +19,105 @@
 #include <image/bg.hpp>
 #include <image/bg_background.hpp>
 
+#include <array>
 #include <cassert>
-#include <cstdio>
+#include <cstring>
 
 
 namespace Root {
-  ConfigScene::ConfigScene(SceneManager& sceneManager) :
-    Scene(sceneManager),
-    mSelection(Item::Mode)
-  {
-    gba::reg::DISPCNT = gba::DISPCNT::FORCE_BLANK;
-
-    BGClearMap<Config::ScrBase::BG0Config>();
-
-    gba::reg::BG0CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG0Config) | Config::Priority::BG0;
-
-    gba::reg::DISPCNT = gba::DISPCNT::BGMODE0 | gba::DISPCNT::BG0 | gba::DISPCNT::BG3;
-  }
-
-
-  void ConfigScene::Render() {
-    BGClearMap<Config::ScrBase::BG0Config>();
-
-    unsigned int y = Config::Config::MenuTextScreenY;
-    unsigned int itemCount = 0;
-    const auto PrintConfigLine = [this, &y, &itemCount] (const char* key, const char* value) {
-      const auto selectArrow = itemCount == static_cast<unsigned int>(mSelection) ? '>' : ' ';
-
-      static char buffer[32];
-      std::snprintf(buffer, sizeof(buffer), "%5s  %c%s", key, selectArrow, value);
-      TilePrint<Config::ScrBase::BG0Config>(buffer, Config::Config::MenuTextScreenX, y);
-      itemCount++;
-      y += 2;
+  namespace {
+    // 「見出し（5文字右詰め）  矢印 値」の各位置
+    constexpr unsigned int KeyWidth = 5;
+    constexpr unsigned int CursorX = Config::Config::MenuTextScreenX + KeyWidth + 2;
+    constexpr unsigned int ValueX = Config::Config::MenuTextScreenX + KeyWidth + 3;
+
+    // 各項目の行
+    constexpr std::array<unsigned int, 5> ItemRows{
+      Config::Config::MenuTextScreenY,
+      Config::Config::MenuTextScreenY + 2,
+      Config::Config::MenuTextScreenY + 4,
+      Config::Config::MenuTextScreenY + 6,
+      Config::Config::MenuTextScreenY + 10,
     };
 
-    const auto& globalConfig = GameConfig::GetGlobalConfig();
-
-    // MODE
-    const char* modeStrings[static_cast<unsigned int>(GameConfig::Mode::End)] = {
+    constexpr const char* ModeStrings[static_cast<unsigned int>(GameConfig::Mode::End)] = {
       "150 LINES",
       "999 LINES",
     };
-    PrintConfigLine("MODE", modeStrings[static_cast<unsigned int>(globalConfig.mode)]);
-
-    // LEVEL
-    char levelString[16];
-    if (globalConfig.extreme) {
-      std::snprintf(levelString, sizeof(levelString), "EX");
-    } else {
-      std::snprintf(levelString, sizeof(levelString), "%02d", globalConfig.level);
-    }
-    PrintConfigLine("LEVEL", levelString);
 
-    // MUSIC
-    const char* musicStrings[static_cast<unsigned int>(GameConfig::Music::End)] = {
+    constexpr const char* MusicStrings[static_cast<unsigned int>(GameConfig::Music::End)] = {
       "TETRIS 99",
       "WATATEN",
       "NK-POP",
     };
-    PrintConfigLine("MUSIC", musicStrings[static_cast<unsigned int>(globalConfig.music)]);
 
-    // BG
-    const char* bgStrings[static_cast<unsigned int>(GameConfig::Background::End)] = {
+    constexpr const char* BackgroundStrings[static_cast<unsigned int>(GameConfig::Background::End)] = {
       "GRAY",
       "FLAME",
       "BLACK",
     };
-    PrintConfigLine("BG", bgStrings[static_cast<unsigned int>(globalConfig.background)]);
 
-    //
-    y += 2;
-    PrintConfigLine("", "RETURN");
+    // EXTREME のときは 0
+    unsigned int GetDisplayLevel() {
+      const auto& globalConfig = GameConfig::GetGlobalConfig();
+      return globalConfig.extreme ? 0 : globalConfig.level;
+    }
+  }   // namespace
+
+
+  ConfigScene::ConfigScene(SceneManager& sceneManager) :
+    Scene(sceneManager),
+    mSelection(Item::Mode),
+    mCursor(CursorX, ItemRows, [this] () {
+      return static_cast<unsigned int>(mSelection);
+    }),
+    mModeValue(ValueX, ItemRows[0], [] () {
+      return GameConfig::GetGlobalConfig().mode;
+    }, [] (char* buffer, GameConfig::Mode mode) {
+      std::strcpy(buffer, ModeStrings[static_cast<unsigned int>(mode)]);
+    }),
+    mLevelValue(ValueX, ItemRows[1], GetDisplayLevel, [] (char* buffer, unsigned int level) {
+      if (level == 0) {
+        std::strcpy(buffer, "EX");
+      } else {
+        FormatNumber(buffer, level, 2, '0');
+      }
+    }),
+    mMusicValue(ValueX, ItemRows[2], [] () {
+      return GameConfig::GetGlobalConfig().music;
+    }, [] (char* buffer, GameConfig::Music music) {
+      std::strcpy(buffer, MusicStrings[static_cast<unsigned int>(music)]);
+    }),
+    mBackgroundValue(ValueX, ItemRows[3], [] () {
+      return GameConfig::GetGlobalConfig().background;
+    }, [] (char* buffer, GameConfig::Background background) {
+      std::strcpy(buffer, BackgroundStrings[static_cast<unsigned int>(background)]);
+    })
+  {
+    static_assert(ItemRows.size() == NumSelections);
+
+    gba::reg::DISPCNT = gba::DISPCNT::FORCE_BLANK;
+
+    BGClearMap<Config::ScrBase::BG0Config>();
+
+    // 見出しは変わらないのでここで描いておき、Render() では値と矢印のうち変わったものだけを描き直す
+    const char* const keys[] = {"MODE", "LEVEL", "MUSIC", "BG", ""};
+    for (unsigned int i = 0; i < NumSelections; i++) {
+      const unsigned int keyLength = std::strlen(keys[i]);
+      TilePrintSpace<Config::ScrBase::BG0Config>(Config::Config::MenuTextScreenX, ItemRows[i], KeyWidth - keyLength);
+      TilePrint<Config::ScrBase::BG0Config>(keys[i], Config::Config::MenuTextScreenX + KeyWidth - keyLength, ItemRows[i]);
+      TilePrintSpace<Config::ScrBase::BG0Config>(Config::Config::MenuTextScreenX + KeyWidth, ItemRows[i], CursorX - (Config::Config::MenuTextScreenX + KeyWidth));
+    }
+    TilePrint<Config::ScrBase::BG0Config>("RETURN", ValueX, ItemRows[static_cast<unsigned int>(Item::Return)]);
+
+    gba::reg::BG0CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG0Config) | Config::Priority::BG0;
+
+    gba::reg::DISPCNT = gba::DISPCNT::BGMODE0 | gba::DISPCNT::BG0 | gba::DISPCNT::BG3;
+  }
+
+
+  void ConfigScene::Render() {
+    TileUI::Render(mCursor, mModeValue, mLevelValue, mMusicValue, mBackgroundValue);
   }
 
 
@@ -205,5 +233,8 @@ namespace Root {
         PlayMusicFromConfig();
       }
     }
+
+    // コナミコマンドで EXTREME になることもあるので値は毎フレーム読み直す
+    TileUI::Update(mCursor, mModeValue, mLevelValue, mMusicValue, mBackgroundValue);
   }
 }   // namespace Root
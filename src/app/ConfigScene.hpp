@@ -1,6 +1,9 @@
 #pragma once
 
+#include "Config.hpp"
+#include "GameConfig.hpp"
 #include "Scene.hpp"
+#include "TileUI.hpp"
 
 
 namespace Root {
@@ -18,6 +21,12 @@ namespace Root {
 
     Item mSelection;
 
+    TileUI::Cursor<Config::ScrBase::BG0Config, NumSelections> mCursor;
+    TileUI::Value<Config::ScrBase::BG0Config, 9, GameConfig::Mode> mModeValue;
+    TileUI::Value<Config::ScrBase::BG0Config, 2, unsigned int> mLevelValue;
+    TileUI::Value<Config::ScrBase::BG0Config, 9, GameConfig::Music> mMusicValue;
+    TileUI::Value<Config::ScrBase::BG0Config, 5, GameConfig::Background> mBackgroundValue;
+
   public:
     ConfigScene(SceneManager& sceneManager);
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "CopyVRAM.hpp"
+
 #include <array>
+#include <cassert>
 #include <cstdint>
 
 #include <gba.hpp>
@@ -15,14 +18,14 @@ inline void BGCopyMap(const T& src) {
 
   constexpr auto SourceHeight = ArraySize / SourceWidth;
 
-  auto ptrSource = src.data();
-  auto ptrDestination = gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock> + (DestinationY * BGWidth + DestinationX);
-  for (unsigned int y = 0; y < SourceHeight; y++) {
-    for (unsigned int x = 0; x < SourceWidth; x++) {
-      *ptrDestination++ = *ptrSource++;
-    }
-    ptrDestination += BGWidth - SourceWidth;
-  }
+  using Entry = typename T::value_type;
+  static_assert(sizeof(Entry) == sizeof(std::uint16_t));
+
+  constexpr auto DestinationAddress = gba::memory::VRAM_BGMAP<ScreenBaseBlock> + (DestinationY * BGWidth + DestinationX) * sizeof(Entry);
+
+  assert(reinterpret_cast<std::uintptr_t>(src.data()) % CopyVRAMInternal::SourceAlignment == 0);
+
+  CopyVRAMInternal::CopyRect<SourceWidth * sizeof(Entry), SourceHeight, BGWidth * sizeof(Entry), SourceWidth * sizeof(Entry), CopyVRAMInternal::AlignmentOf(DestinationAddress)>(DestinationAddress, src.data());
 }
 
 
@@ -30,11 +33,7 @@ template<std::uint_fast8_t ScreenBaseBlock, unsigned int BGWidth, unsigned int X
 inline void BGClearMap() {
   static_assert(Width <= BGWidth);
 
-  auto ptr = gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock> + (Y * BGWidth + X);
-  for (unsigned int y = 0; y < Height; y++) {
-    for (unsigned int x = 0; x < Width; x++) {
-      *ptr++ = 0;
-    }
-    ptr += BGWidth - Width;
-  }
+  constexpr auto DestinationAddress = gba::memory::VRAM_BGMAP<ScreenBaseBlock> + (Y * BGWidth + X) * sizeof(std::uint16_t);
+
+  CopyVRAMInternal::FillRect<Width * sizeof(std::uint16_t), Height, BGWidth * sizeof(std::uint16_t), CopyVRAMInternal::AlignmentOf(DestinationAddress)>(DestinationAddress, 0);
 }
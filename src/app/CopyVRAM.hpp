@@ -1,74 +1,232 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
 
 #include <gba.hpp>
 
 
+// VRAM（BG/OBJ のタイル、マップ、パレット）へのコピーとフィル
+// 転送方法はサイズとアライメントからコンパイル時に選ぶ
+//
+//   コピー：4バイト境界で4バイト単位なら DMA3（32bit）、そうでなければ CpuSet（16bit）
+//   フィル：32バイト単位なら CpuFastSet、4バイト単位なら CpuSet（32bit）、それ以外は CpuSet（16bit）
+//           （DMA のフィルは1ワードごとに転送元を読み直すので、STMIA で8ワードずつ書く CpuFastSet の方が速い）
+//   どちらも LoopThreshold バイト未満なら DMA や SWI の準備の方が高くつくので普通に代入する
+//
+// std::array のコピー元は4バイト境界に置かれているものとする（画像リソースは alignas(4) で出力している）
 namespace CopyVRAMInternal {
-  template<typename T>
-  inline void Copy(volatile T* dest, const T* src, std::size_t count) {
-    for (std::size_t i = 0; i < count; i++) {
-      dest[i] = src[i];
+  enum class Method {
+    Loop,
+    DMA3,
+    CpuFastSet,
+    CpuSet32,
+    CpuSet16,
+  };
+
+  constexpr std::size_t LoopThreshold = 16;
+
+  constexpr std::size_t SourceAlignment = sizeof(std::uint32_t);
+
+  // CpuSet / CpuFastSet の r2
+  constexpr unsigned int CpuSetFill = 1 << 24;
+  constexpr unsigned int CpuSet32Bit = 1 << 26;
+
+  constexpr std::size_t AlignmentOf(std::uintptr_t address) {
+    return address % 4 == 0 ? 4 : address % 2 == 0 ? 2 : 1;
+  }
+
+  constexpr Method SelectCopyMethod(std::size_t bytes, std::size_t alignment) {
+    if (bytes < LoopThreshold) {
+      return Method::Loop;
+    }
+    if (alignment % 4 == 0 && bytes % 4 == 0) {
+      return Method::DMA3;
+    }
+    return Method::CpuSet16;
+  }
+
+  constexpr Method SelectFillMethod(std::size_t bytes, std::size_t alignment) {
+    if (bytes < LoopThreshold) {
+      return Method::Loop;
+    }
+    if (alignment % 4 == 0 && bytes % 32 == 0) {
+      return Method::CpuFastSet;
+    }
+    if (alignment % 4 == 0 && bytes % 4 == 0) {
+      return Method::CpuSet32;
+    }
+    return Method::CpuSet16;
+  }
+
+
+  // src から destAddress へ Bytes バイトコピーする、Alignment は src と destAddress の両方が揃っている境界
+  template<std::size_t Bytes, std::size_t Alignment>
+  inline void Copy(std::uintptr_t destAddress, const void* src) {
+    using u16 = std::uint16_t;
+
+    static_assert(Bytes % sizeof(u16) == 0 && Alignment % sizeof(u16) == 0, "VRAM can not be written in bytes");
+
+    constexpr Method method = SelectCopyMethod(Bytes, Alignment);
+
+    if constexpr (method == Method::Loop) {
+      const auto dest = reinterpret_cast<volatile u16*>(destAddress);
+      const auto ptrSrc = static_cast<const u16*>(src);
+      for (std::size_t i = 0; i < Bytes / sizeof(u16); i++) {
+        dest[i] = ptrSrc[i];
+      }
+    } else if constexpr (method == Method::DMA3) {
+      // DMA3 で一度に送れるのは 0x10000 ワードまで
+      static_assert(Bytes / sizeof(std::uint32_t) <= 0x10000);
+
+      gba::DMA3Copy(src, reinterpret_cast<void*>(destAddress), Bytes / sizeof(std::uint32_t));
+    } else {
+      static_assert(method == Method::CpuSet16);
+
+      gba::bios::CpuSet(src, reinterpret_cast<void*>(destAddress), Bytes / sizeof(u16));
     }
   }
 
-  template<typename T, std::size_t S>
-  inline void Copy(std::uintptr_t destAddress, const std::array<T, S>& src) {
+
+  // destAddress から Bytes バイトを value で埋める
+  template<std::size_t Bytes, std::size_t Alignment>
+  inline void Fill(std::uintptr_t destAddress, std::uint16_t value) {
     using u16 = std::uint16_t;
     using u32 = std::uint32_t;
 
-    constexpr std::size_t TSize = sizeof(T);
+    static_assert(Bytes % sizeof(u16) == 0 && Alignment % sizeof(u16) == 0, "VRAM can not be written in bytes");
 
-    static_assert(TSize % sizeof(u16) == 0);
+    constexpr Method method = SelectFillMethod(Bytes, Alignment);
 
-    if constexpr (TSize < sizeof(u32) && TSize * S % sizeof(u32) == 0) {
-      Copy(reinterpret_cast<volatile u32*>(destAddress), reinterpret_cast<const u32*>(src.data()), S * TSize / sizeof(u32));
-      return;
+    // CpuSet / CpuFastSet は転送元のワード（16bit のときは下位のハーフワード）を読む
+    const u32 word = value | (static_cast<u32>(value) << 16);
+    const auto dest = reinterpret_cast<void*>(destAddress);
+
+    if constexpr (method == Method::Loop) {
+      const auto ptrDest = reinterpret_cast<volatile u16*>(destAddress);
+      for (std::size_t i = 0; i < Bytes / sizeof(u16); i++) {
+        ptrDest[i] = value;
+      }
+    } else if constexpr (method == Method::CpuFastSet) {
+      gba::bios::CpuFastSet(&word, dest, Bytes / sizeof(u32) | CpuSetFill);
+    } else if constexpr (method == Method::CpuSet32) {
+      gba::bios::CpuSet(&word, dest, Bytes / sizeof(u32) | CpuSetFill | CpuSet32Bit);
+    } else {
+      static_assert(method == Method::CpuSet16);
+
+      gba::bios::CpuSet(&word, dest, Bytes / sizeof(u16) | CpuSetFill);
     }
+  }
 
-    Copy(reinterpret_cast<volatile T*>(destAddress), src.data(), S);
+
+  // 矩形のコピー（1行 RowBytes バイトを Rows 行）
+  // 各行の先頭は destAddress + y * DestPitch、src + y * SourcePitch
+  // 行が隙間なく並んでいれば1回で転送する
+  template<std::size_t RowBytes, std::size_t Rows, std::size_t DestPitch, std::size_t SourcePitch, std::size_t Alignment>
+  inline void CopyRect(std::uintptr_t destAddress, const void* src) {
+    if constexpr (RowBytes == DestPitch && RowBytes == SourcePitch) {
+      Copy<RowBytes * Rows, Alignment>(destAddress, src);
+    } else {
+      constexpr std::size_t RowAlignment = std::min({Alignment, AlignmentOf(DestPitch), AlignmentOf(SourcePitch)});
+
+      const auto ptrSrc = static_cast<const std::uint8_t*>(src);
+      for (std::size_t y = 0; y < Rows; y++) {
+        Copy<RowBytes, RowAlignment>(destAddress + y * DestPitch, ptrSrc + y * SourcePitch);
+      }
+    }
+  }
+
+
+  // 矩形のフィル（1行 RowBytes バイトを Rows 行、各行の先頭は destAddress + y * DestPitch）
+  template<std::size_t RowBytes, std::size_t Rows, std::size_t DestPitch, std::size_t Alignment>
+  inline void FillRect(std::uintptr_t destAddress, std::uint16_t value) {
+    if constexpr (RowBytes == DestPitch) {
+      Fill<RowBytes * Rows, Alignment>(destAddress, value);
+    } else {
+      constexpr std::size_t RowAlignment = std::min(Alignment, AlignmentOf(DestPitch));
+
+      for (std::size_t y = 0; y < Rows; y++) {
+        Fill<RowBytes, RowAlignment>(destAddress + y * DestPitch, value);
+      }
+    }
+  }
+
+
+  template<std::uintptr_t DestAddress, typename T, std::size_t S>
+  inline void Copy(const std::array<T, S>& src) {
+    assert(reinterpret_cast<std::uintptr_t>(src.data()) % SourceAlignment == 0);
+
+    Copy<sizeof(T) * S, std::min(SourceAlignment, AlignmentOf(DestAddress))>(DestAddress, src.data());
   }
 }
 
 
 template<std::uint_fast8_t CharacterBaseBlock, typename T, std::size_t S>
 inline void BGCopyTile(const std::array<T, S>& src) {
-  CopyVRAMInternal::Copy(gba::memory::VRAM_BGTILE<CharacterBaseBlock>, src);
+  CopyVRAMInternal::Copy<gba::memory::VRAM_BGTILE<CharacterBaseBlock>>(src);
 }
 
 
 template<std::uint_fast8_t ScreenBaseBlock, typename T, std::size_t S>
 inline void BGCopyMap(const std::array<T, S>& src) {
-  CopyVRAMInternal::Copy(gba::memory::VRAM_BGMAP<ScreenBaseBlock>, src);
+  CopyVRAMInternal::Copy<gba::memory::VRAM_BGMAP<ScreenBaseBlock>>(src);
 }
 
 
 template<std::uint_fast8_t ScreenBaseBlock>
 inline void BGClearMap() {
-  using Block = std::uint32_t;
-  const auto map = gba::template_memory::VRAM_BGMAP<ScreenBaseBlock, Block>;
-  for (std::size_t i = 0; i < 0x800 / sizeof(Block); i++) {
-    map[i] = 0;
-  }
+  CopyVRAMInternal::Fill<0x800, CopyVRAMInternal::AlignmentOf(gba::memory::VRAM_BGMAP<ScreenBaseBlock>)>(gba::memory::VRAM_BGMAP<ScreenBaseBlock>, 0);
 }
 
 
 template<std::uint_fast8_t BeginIndex = 0, typename T, std::size_t S>
 inline void BGCopyPalette(const std::array<T, S>& src) {
-  CopyVRAMInternal::Copy(gba::memory::PALETTE_BG + BeginIndex * 32, src);
+  CopyVRAMInternal::Copy<gba::memory::PALETTE_BG + BeginIndex * 32>(src);
 }
 
 
 template<bool Narrow = false, typename T, std::size_t S>
 inline void OBJCopyTile(const std::array<T, S>& src) {
-  CopyVRAMInternal::Copy(Narrow ? gba::memory::VRAM_OBJTILE16 : gba::memory::VRAM_OBJTILE32, src);
+  CopyVRAMInternal::Copy<Narrow ? gba::memory::VRAM_OBJTILE16 : gba::memory::VRAM_OBJTILE32>(src);
 }
 
 
 template<std::uint_fast8_t BeginIndex = 0, typename T, std::size_t S>
 inline void OBJCopyPalette(const std::array<T, S>& src) {
-  CopyVRAMInternal::Copy(gba::memory::PALETTE_OBJ + BeginIndex * 32, src);
+  CopyVRAMInternal::Copy<gba::memory::PALETTE_OBJ + BeginIndex * 32>(src);
+}
+
+
+// 圧縮したデータ（resources/image/index.js が出力する ...LZ77、...RL）を destAddress に展開する
+// BIOS が 16bit 単位で書くので VRAM に直接展開できる
+// 展開し終わるまで戻らない（大きなタイルだと数フレームかかる）ので、表示中の画面は書き換えないこと
+template<std::size_t S>
+inline void DecompressLZ77VRAM(std::uintptr_t destAddress, const std::array<std::uint32_t, S>& src) {
+  gba::bios::LZ77UnCompReadNormalWrite16bit(src.data(), reinterpret_cast<void*>(destAddress));
+}
+
+
+template<std::size_t S>
+inline void DecompressRLVRAM(std::uintptr_t destAddress, const std::array<std::uint32_t, S>& src) {
+  gba::bios::RLUnCompReadNormalWrite16bit(src.data(), reinterpret_cast<void*>(destAddress));
+}
+
+
+// ...Diff16LZ77 を dest に展開する
+// LZ77 を展開した差分を work に置いてから Diff16bitUnFilter で戻すので、work は展開後のサイズ + 4 バイト（ヘッダ）必要
+template<std::size_t S, std::size_t W>
+inline void DecompressDiff16LZ77(void* dest, const std::array<std::uint32_t, S>& src, std::array<std::uint32_t, W>& work) {
+  assert((src[0] >> 8) <= sizeof(std::uint32_t) * W);
+
+  gba::bios::LZ77UnCompReadNormalWrite8bit(src.data(), work.data());
+  gba::bios::Diff16bitUnFilter(work.data(), dest);
+}
+
+
+// BG と OBJ のパレットをすべて黒（0）にする
+inline void ClearPalette() {
+  CopyVRAMInternal::Fill<0x400, CopyVRAMInternal::AlignmentOf(gba::memory::PALETTE_BG)>(gba::memory::PALETTE_BG, 0);
 }
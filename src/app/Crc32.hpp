@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+
+// CRC-32 (IEEE 802.3, 反転入出力)
+// 初期値にひとつ前の結果を渡すと連結したデータのCRCになるので、フレームごとのローリングチェックサムに使える
+namespace Crc32 {
+  using Value = std::uint32_t;
+
+  constexpr Value InitialValue = 0;
+
+  namespace InternalImpl {
+    constexpr Value Polynomial = 0xEDB88320;
+
+    constexpr auto Table = ([]() constexpr {
+      std::array<Value, 256> table{};
+      for (Value i = 0; i < table.size(); i++) {
+        Value crc = i;
+        for (unsigned int j = 0; j < 8; j++) {
+          crc = (crc >> 1) ^ ((crc & 1) ? Polynomial : 0);
+        }
+        table[i] = crc;
+      }
+      return table;
+    })();
+  }   // namespace InternalImpl
+
+
+  inline Value Update(Value crc, const void* data, std::size_t size) {
+    const auto* ptr = static_cast<const std::uint8_t*>(data);
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; i++) {
+      crc = InternalImpl::Table[(crc ^ ptr[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+  }
+
+  // パディングを含まない値（整数・列挙型）用
+  // 環境によらず同じ結果になるよう32ビットに揃えてから流し込む
+  template<typename T>
+  inline Value UpdateValue(Value crc, T value) {
+    static_assert(std::is_integral_v<T> || std::is_enum_v<T>);
+
+    const auto u32 = static_cast<std::uint32_t>(value);
+    const std::array<std::uint8_t, 4> bytes{
+      static_cast<std::uint8_t>(u32),
+      static_cast<std::uint8_t>(u32 >> 8),
+      static_cast<std::uint8_t>(u32 >> 16),
+      static_cast<std::uint8_t>(u32 >> 24),
+    };
+    return Update(crc, bytes.data(), bytes.size());
+  }
+}   // namespace Crc32
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+// 1フレームのサイクル数（228ライン * 1232サイクル）
+constexpr std::uint32_t CyclesPerFrame = 280896;
+
+
+// TM2（1サイクル単位）と TM3（TM2のオーバーフローでカウントアップ）を連結した32ビットのサイクルカウンタ
+// タイマーは Root::SceneManager のコンストラクタで開始している
+// 2^32 サイクル（16.78MHz で約256秒）で1周するので、差分は std::uint32_t のまま引き算すること
+inline std::uint32_t ReadCycleCounter() {
+  // 下位を読む間に桁上がりした場合に備え、上位が変わらなくなるまで読み直す
+  std::uint32_t high;
+  std::uint32_t low;
+  do {
+    high = gba::reg::TM3CNT_L;
+    low = gba::reg::TM2CNT_L;
+  } while (high != gba::reg::TM3CNT_L);
+  return (high << 16) | low;
+}
@@ -7,6 +7,13 @@
 
 # define DbgPrintf(...)
 
+#elif defined(GBA_HOST)
+
+template<typename... Args>
+void DbgPrintf(Args... args) {
+  std::fprintf(stderr, args...);
+}
+
 #else
 
 template<typename... Args>
@@ -3,7 +3,7 @@
 #include <gba.hpp>
 
 
-#ifdef RELEASE_BUILD
+#if defined(RELEASE_BUILD) || defined(GBA_HOST)
 
 # define DbgWait(...)
 
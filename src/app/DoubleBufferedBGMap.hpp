@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+// BGマップの Y 行目から Height 行分（横は32タイル全て）の WRAM 上のコピーと、それを表示する2つのスクリーンブロック
+// 描画は WRAM 上のコピーに行い、Flush() で表示していない方（裏）に DMA3 で転送する
+// 裏への転送はいつ行ってもよく、Flip() で表と裏を入れ替えたあと呼び出し側が BGxCNT の SCRBASE を GetScreenBaseBlock() に切り替える
+// SCRBASE の切り替えは画面の途中で行うと上下で新旧の盤面が混ざるので VBlank 中に行うこと
+//
+// WRAM 上のコピーとの差分を各スクリーンブロックについて行ごとに覚えておき、Flush() ではその行だけを転送する
+// （裏は2回前の Flush() の内容なので、直近2回の間に変わった行が転送される）
+template<std::uint_fast8_t ScreenBaseBlock0, std::uint_fast8_t ScreenBaseBlock1, unsigned int Y, unsigned int Height>
+class DoubleBufferedBGMap {
+  static constexpr unsigned int BGWidth = 32;
+  static constexpr unsigned int BGHeight = 32;
+
+  static_assert(Y + Height <= BGHeight);
+
+  // bit y = Y + y 行目
+  using RowMask = std::uint32_t;
+  static_assert(Height <= sizeof(RowMask) * 8);
+
+  static constexpr RowMask AllRows = Height == sizeof(RowMask) * 8 ? ~RowMask{0} : (RowMask{1} << Height) - 1;
+
+  static constexpr std::array<std::uint_fast8_t, 2> ScreenBaseBlocks{ScreenBaseBlock0, ScreenBaseBlock1};
+  static constexpr std::array<std::uintptr_t, 2> MapAddresses{gba::memory::VRAM_BGMAP<ScreenBaseBlock0>, gba::memory::VRAM_BGMAP<ScreenBaseBlock1>};
+
+  alignas(4) std::array<std::uint16_t, BGWidth * Height> mMap;
+
+  // スクリーンブロックごとの、WRAM 上のコピーと内容が異なる行
+  std::array<RowMask, 2> mStaleRows;
+
+  // 表示している方（ScreenBaseBlocks のインデックス）
+  unsigned int mFront;
+
+  // 裏を WRAM 上のコピーと同じにしたが、まだ表と入れ替えていない
+  bool mFlipPending;
+
+public:
+  DoubleBufferedBGMap() :
+    mMap{},
+    mStaleRows{AllRows, AllRows},
+    mFront(0),
+    mFlipPending(false)
+  {}
+
+  // x, y はBGマップ上の座標（y は Y 以上 Y + Height 未満）
+  void SetTile(unsigned int x, unsigned int y, std::uint16_t tile) {
+    assert(x < BGWidth && y >= Y && y < Y + Height);
+    auto& dest = mMap[(y - Y) * BGWidth + x];
+    if (dest == tile) {
+      return;
+    }
+    dest = tile;
+
+    const RowMask row = RowMask{1} << (y - Y);
+    mStaleRows[0] |= row;
+    mStaleRows[1] |= row;
+  }
+
+  std::uint16_t GetTile(unsigned int x, unsigned int y) const {
+    assert(x < BGWidth && y >= Y && y < Y + Height);
+    return mMap[(y - Y) * BGWidth + x];
+  }
+
+  // 裏の古くなった行を転送する
+  void Flush() {
+    const unsigned int back = mFront ^ 1;
+
+    const RowMask staleRows = mStaleRows[back];
+    mStaleRows[back] = 0;
+
+    // 連続する行はまとめて転送する
+    for (unsigned int y = 0; y < Height; ) {
+      if (!(staleRows & (RowMask{1} << y))) {
+        y++;
+        continue;
+      }
+
+      const unsigned int first = y;
+      while (y < Height && (staleRows & (RowMask{1} << y))) {
+        y++;
+      }
+
+      gba::DMA3Copy(&mMap[first * BGWidth], reinterpret_cast<void*>(MapAddresses[back] + (Y + first) * BGWidth * sizeof(std::uint16_t)), (y - first) * BGWidth * sizeof(std::uint16_t) / sizeof(std::uint32_t));
+    }
+
+    // 表が古くなっていれば入れ替える必要がある
+    mFlipPending = mStaleRows[mFront] != 0;
+  }
+
+  // 表と裏を入れ替える、入れ替えた場合は true を返す
+  bool Flip() {
+    if (!mFlipPending) {
+      return false;
+    }
+    mFront ^= 1;
+    mFlipPending = false;
+    return true;
+  }
+
+  // 表示すべきスクリーンブロック
+  std::uint_fast8_t GetScreenBaseBlock() const {
+    return ScreenBaseBlocks[mFront];
+  }
+};
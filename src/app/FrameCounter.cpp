@@ -0,0 +1,44 @@
+#include "FrameCounter.hpp"
+#include "CycleCounter.hpp"
+
+#include <cstdint>
+
+
+#ifdef BENCHMARK_BUILD
+namespace FrameCounter {
+  namespace {
+    volatile Publication gPublication __attribute__((used)) = {
+      Magic0,
+      Magic1,
+      0,
+      0,
+      0,
+      NoSubScene,
+    };
+
+    std::uint32_t gFrameBeginCycle = 0;
+  }   // namespace
+
+
+  void BeginFrame() {
+    gFrameBeginCycle = ReadCycleCounter();
+  }
+
+
+  void EndFrame() {
+    gPublication.cycles = ReadCycleCounter() - gFrameBeginCycle;
+    gPublication.frame = gPublication.frame + 1;
+  }
+
+
+  void SetRootScene(unsigned int sceneId) {
+    gPublication.rootSceneId = sceneId;
+    gPublication.subSceneId = NoSubScene;
+  }
+
+
+  void SetSubScene(unsigned int sceneId) {
+    gPublication.subSceneId = sceneId;
+  }
+}   // namespace FrameCounter
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+
+// ベンチマーク用に、1フレームの処理にかかったサイクル数を WRAM 上の決まった形の構造体に毎フレーム書き出す
+// エミュレータ側（benchmark/bench.lua）はマジックナンバーで構造体を探して読む
+// BENCHMARK_BUILD が定義されていないときは何もしない
+namespace FrameCounter {
+  // 'TETR' 'BNCH'
+  constexpr std::uint32_t Magic0 = 0x52544554;
+  constexpr std::uint32_t Magic1 = 0x48434E42;
+
+  constexpr std::uint16_t NoSubScene = 0xFFFF;
+
+  struct Publication {
+    std::uint32_t magic0;
+    std::uint32_t magic1;
+    std::uint32_t frame;          // 書き出したフレーム番号（1から）
+    std::uint32_t cycles;         // VBlank待ち明けから次のVBlank待ちまでのサイクル数（割り込み処理を含む）
+    std::uint16_t rootSceneId;    // Root::SceneId
+    std::uint16_t subSceneId;     // GameTetra::SceneId、それ以外のシーンでは NoSubScene
+  };
+
+#ifdef BENCHMARK_BUILD
+  void BeginFrame();
+  void EndFrame();
+  void SetRootScene(unsigned int sceneId);
+  void SetSubScene(unsigned int sceneId);
+#else
+  inline void BeginFrame() {}
+  inline void EndFrame() {}
+  inline void SetRootScene([[maybe_unused]] unsigned int sceneId) {}
+  inline void SetSubScene([[maybe_unused]] unsigned int sceneId) {}
+#endif
+}   // namespace FrameCounter
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Scene.hpp"
-#include "tetra/SceneManager.hpp"
+#include "Tetra/SceneManager.hpp"
 
 
 namespace Root {
@@ -1,39 +1,43 @@
 #include "IRQ.hpp"
-#include "DbgPrintf.hpp"
+#include "Profiler.hpp"
 #include "Sound/MusicManager.hpp"
 #include "Sound/SoundManager.hpp"
 
-#include <cstdint>
 #include <gba.hpp>
 
 
-void CommonISR() {
-  gba::reg::IME = 0;
+namespace {
+  // gba::irq::SetHandler() の priority（小さいほど優先）
+  constexpr unsigned int SoundDMAPriority = 0;
+  constexpr unsigned int VBlankPriority   = 1;
 
-  const auto flag = gba::reg::IF;
 
-  //DbgPrintf("IRQ: %d\n");
+  IWRAM_CODE void VBlankHandler() {
+    Profiler::Zone<Profiler::ZoneId::VBlankISR> profilerZone;
 
-  std::uint_fast16_t ackFlag = 0;
-  std::uint_fast16_t biosAckFlag = 0;
-
-  if (flag & gba::IF::VBLANK) {
-    ackFlag |= gba::IF::VBLANK;
-    biosAckFlag |= gba::IF::VBLANK;
+    Profiler::NotifyVBlank();
 
     MusicManager::GetInstance().Step();
   }
 
-  ackFlag |= SoundManager::GetInstance().IRQ(flag);
 
-  gba::reg::IF = ackFlag;
-  gba::reg::INTCHK = biosAckFlag;
+  IWRAM_CODE void SoundDMA1Handler() {
+    SoundManager::GetInstance().IRQ(gba::IF::DMA1);
+  }
+
+
+  IWRAM_CODE void SoundDMA2Handler() {
+    SoundManager::GetInstance().IRQ(gba::IF::DMA2);
+  }
+}   // namespace
 
-  gba::reg::IME = gba::IME::ENABLE;
-}
 
+void SetCommonIRQHandlers() {
+  gba::irq::SetHandler(gba::IF::DMA1, SoundDMA1Handler, SoundDMAPriority);
+  gba::irq::SetHandler(gba::IF::DMA2, SoundDMA2Handler, SoundDMAPriority);
+  gba::irq::SetHandler(gba::IF::VBLANK, VBlankHandler, VBlankPriority, true);
+  gba::irq::UseDispatcher();
 
-void SetCommonIRQFlags() {
   gba::reg::DISPSTAT |= gba::DISPSTAT::VBLANK_IRQ;
   gba::reg::IE = gba::IE::VBLANK | gba::IE::DMA1 | gba::IE::DMA2;   // DMA is for SoundManager
 
@@ -1,7 +1,7 @@
 #pragma once
 
-#include <gba.hpp>
 
-
-void CommonISR();
-void SetCommonIRQFlags();
+// 割り込みハンドラを gba::irq の表に登録して IE を立てる（IME は呼ぶ側が立てる）
+// サウンドの DMA を一番優先し、時間のかかる VBlank（MusicManager::Step()）の実行中も割り込めるようにしている
+// ほかの割り込み（HBlank、VCount、タイマー、キーなど）は gba::irq::SetHandler() で追加して IE を立てる
+void SetCommonIRQHandlers();
@@ -1,16 +1,19 @@
 #include <gba.hpp>
 
 #include "IRQ.hpp"
+#include "MemoryUsage.hpp"
 #include "SceneManager.hpp"
 
 int main() {
-  gba::irq::SetISR(CommonISR);
-  SetCommonIRQFlags();
+  MemoryUsage::Paint();
+
+  SetCommonIRQHandlers();
 
   auto& sceneManager = Root::SceneManager::GetInstance();
 
   while (true) {
     sceneManager.Render();
     sceneManager.Update();
+    sceneManager.WaitForVBlank();
   }
 }
@@ -0,0 +1,106 @@
+#include "MemoryUsage.hpp"
+#include "DbgPrintf.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+
+#if !defined(RELEASE_BUILD) && !defined(GBA_HOST)
+#include <malloc.h>
+#include <unistd.h>
+
+// gba.ls / gba_rom.ls
+extern "C" std::uint32_t __iwram_end[];
+extern "C" std::uint32_t __stack_start[];
+extern "C" std::uint32_t __stack_end[];
+extern "C" std::uint32_t end[];
+extern "C" std::uint32_t _heap_end[];
+
+namespace MemoryUsage {
+  namespace {
+    constexpr std::uint32_t PaintPattern = 0xDEADBEEF;
+
+    // SP_irq は BIOS が 0x03007FA0 にしている、その下は SP_usr（__stack_end）まで
+    const auto IRQStackStart = reinterpret_cast<std::uint32_t*>(0x03007F00);
+    const auto IRQStackEnd = reinterpret_cast<std::uint32_t*>(0x03007FA0);
+
+    // Paint() 自身のスタックを塗らないように sp からこれだけ空ける
+    constexpr std::size_t StackPaintMargin = 64;
+
+
+    std::size_t SizeOf(const std::uint32_t* begin, const std::uint32_t* end) {
+      return reinterpret_cast<std::uintptr_t>(end) - reinterpret_cast<std::uintptr_t>(begin);
+    }
+
+
+    void Fill(std::uint32_t* begin, std::uint32_t* end) {
+      for (auto p = begin; p < end; p++) {
+        *p = PaintPattern;
+      }
+    }
+
+
+    // end から下に伸びる領域（スタック）で使った大きさ
+    std::size_t UsedDownward(const std::uint32_t* begin, const std::uint32_t* end) {
+      auto p = begin;
+      while (p < end && *p == PaintPattern) {
+        p++;
+      }
+      return SizeOf(p, end);
+    }
+
+
+    // begin から上に伸びる領域（ヒープ）で使った大きさ
+    std::size_t UsedUpward(const std::uint32_t* begin, const std::uint32_t* end) {
+      auto p = end;
+      while (p > begin && p[-1] == PaintPattern) {
+        p--;
+      }
+      return SizeOf(begin, p);
+    }
+
+
+    unsigned int ToUInt(std::size_t size) {
+      return static_cast<unsigned int>(size);
+    }
+  }   // namespace
+
+
+  void Paint() {
+    std::uintptr_t sp;
+    asm volatile("mov %0, sp" : "=r"(sp));
+
+    // スタックは割り当て（__stack_start）より下、IWRAM の末尾（__iwram_end）まで塗って、はみ出しも見えるようにする
+    Fill(__iwram_end, reinterpret_cast<std::uint32_t*>((sp - StackPaintMargin) & ~std::uintptr_t{3}));
+    Fill(IRQStackStart, IRQStackEnd);
+
+    // main() より前に静的コンストラクタが malloc していることがあるので、end からではなく今のヒープの終端から塗る
+    Fill(static_cast<std::uint32_t*>(sbrk(0)), _heap_end);
+  }
+
+
+  Report Measure() {
+    const auto heapBreak = static_cast<const std::uint32_t*>(sbrk(0));
+
+    Report report{};
+    report.stack = Usage{SizeOf(__stack_start, __stack_end), UsedDownward(__iwram_end, __stack_end)};
+    report.irqStack = Usage{SizeOf(IRQStackStart, IRQStackEnd), UsedDownward(IRQStackStart, IRQStackEnd)};
+    report.heap = Usage{SizeOf(end, _heap_end), std::max(UsedUpward(end, _heap_end), SizeOf(end, heapBreak))};
+    report.heapInUse = mallinfo().uordblks;
+    return report;
+  }
+
+
+  void Dump() {
+    const auto report = Measure();
+
+    DbgPrintf("mem: stack %u/%u bytes, irq stack %u/%u bytes\n", ToUInt(report.stack.peak), ToUInt(report.stack.reserved), ToUInt(report.irqStack.peak), ToUInt(report.irqStack.reserved));
+    DbgPrintf("mem: heap %u/%u bytes, in use %u bytes\n", ToUInt(report.heap.peak), ToUInt(report.heap.reserved), ToUInt(report.heapInUse));
+
+    if (report.stack.peak > report.stack.reserved || report.irqStack.peak > report.irqStack.reserved || report.heap.peak > report.heap.reserved) {
+      DbgPrintf("mem: overflowed the reserved region\n");
+    }
+  }
+}   // namespace MemoryUsage
+#endif
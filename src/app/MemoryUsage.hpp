@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+
+// スタックとヒープがどこまで使われたか（最高水位）を測る
+// 起動直後に Paint() で空いている領域を決まった値で塗っておき、塗られたまま残っている所から使った量を数える
+// 一度でも書かれた所までを使ったとみなす（malloc で確保しただけでまだ書いていない所は、_sbrk で伸ばした分として数える）
+// RELEASE_BUILD と GBA_HOST では全て消える
+namespace MemoryUsage {
+  struct Usage {
+    std::size_t reserved;     // 割り当ててある大きさ（gba.ls の STACK_SIZE、HEAP_SIZE など）
+    std::size_t peak;         // reserved を超えていたら、隣の領域を壊している
+  };
+
+  struct Report {
+    Usage stack;              // System モード（main）のスタック、0x03007F00 から下に伸びる
+    Usage irqStack;           // IRQ モードのスタック（BIOS の IRQ ハンドラと irq_dispatch.s）
+    Usage heap;               // malloc の領域（_sbrk が end から上に伸ばす）
+    std::size_t heapInUse;    // いま malloc で確保している大きさ
+  };
+
+#if !defined(RELEASE_BUILD) && !defined(GBA_HOST)
+  // main() の最初、割り込みを許可する前に呼ぶ
+  void Paint();
+
+  Report Measure();
+
+  // Measure() の結果を DbgPrintf で出力する
+  void Dump();
+#else
+  inline void Paint() {}
+  inline Report Measure() { return Report{}; }
+  inline void Dump() {}
+#endif
+}   // namespace MemoryUsage
@@ -0,0 +1,118 @@
+#include "Profiler.hpp"
+#include "Config.hpp"
+#include "CycleCounter.hpp"
+#include "DbgPrintf.hpp"
+#include "MemoryUsage.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gba.hpp>
+
+
+#ifndef RELEASE_BUILD
+namespace Profiler {
+  namespace {
+    constexpr std::array<const char*, NumZones> ZoneNames{
+      "Render",
+      "Update",
+      "UpdateGame",
+      "RenderBoardTile",
+      "VBlankISR",
+      "MusicStep",
+    };
+
+    std::array<FrameRecord, HistorySize> gHistory{};
+    std::size_t gHistoryIndex = 0;
+    unsigned long gNumFrames = 0;
+
+    std::array<std::uint32_t, NumZones> gCurrentZoneCycles{};
+    std::uint32_t gFrameBeginCycle = 0;
+
+    volatile unsigned int gVBlankCount = 0;
+    unsigned int gFrameBeginVBlankCount = 0;
+
+
+    unsigned long ToPercent(std::uint32_t cycles) {
+      return static_cast<unsigned long>(static_cast<std::uint64_t>(cycles) * 100 / CyclesPerFrame);
+    }
+  }   // namespace
+
+
+  void AddZoneCycles(ZoneId zoneId, std::uint32_t cycles) {
+    gCurrentZoneCycles[static_cast<std::size_t>(zoneId)] += cycles;
+  }
+
+
+  void BeginFrame() {
+    gFrameBeginCycle = ReadCycleCounter();
+    gFrameBeginVBlankCount = gVBlankCount;
+  }
+
+
+  void EndFrame() {
+    const auto frameCycles = ReadCycleCounter() - gFrameBeginCycle;
+
+    gHistoryIndex = (gHistoryIndex + 1) & (HistorySize - 1);
+    auto& record = gHistory[gHistoryIndex];
+
+    // ISR が書き込むので割り込みを止めてから取り出す
+    const auto ime = gba::reg::IME;
+    gba::reg::IME = 0;
+    record.zoneCycles = gCurrentZoneCycles;
+    gCurrentZoneCycles.fill(0);
+    record.overrun = gVBlankCount != gFrameBeginVBlankCount;
+    gba::reg::IME = ime;
+
+    record.frameCycles = frameCycles;
+
+    gNumFrames++;
+
+    if constexpr (Root::Config::Profiler::ReportOverrun) {
+      if (record.overrun) {
+        DbgPrintf("prof: frame %lu overran (%lu cycles, %lu%%)\n", gNumFrames, static_cast<unsigned long>(frameCycles), ToPercent(frameCycles));
+      }
+    }
+
+    if constexpr (Root::Config::Profiler::DumpInterval != 0) {
+      if (gNumFrames % Root::Config::Profiler::DumpInterval == 0) {
+        Dump();
+      }
+    }
+  }
+
+
+  void NotifyVBlank() {
+    gVBlankCount = gVBlankCount + 1;
+  }
+
+
+  const FrameRecord& GetFrameRecord(std::size_t age) {
+    return gHistory[(gHistoryIndex - age) & (HistorySize - 1)];
+  }
+
+
+  void Dump() {
+    const auto& last = GetFrameRecord(0);
+
+    FrameRecord max{};
+    unsigned int numOverruns = 0;
+    for (const auto& record : gHistory) {
+      for (std::size_t i = 0; i < NumZones; i++) {
+        max.zoneCycles[i] = std::max(max.zoneCycles[i], record.zoneCycles[i]);
+      }
+      max.frameCycles = std::max(max.frameCycles, record.frameCycles);
+      numOverruns += record.overrun ? 1 : 0;
+    }
+
+    DbgPrintf("prof: frame %lu, overruns %u/%u\n", gNumFrames, numOverruns, static_cast<unsigned int>(HistorySize));
+    DbgPrintf("  %-16s %8lu %3lu%%  max %8lu %3lu%%\n", "(frame)", static_cast<unsigned long>(last.frameCycles), ToPercent(last.frameCycles), static_cast<unsigned long>(max.frameCycles), ToPercent(max.frameCycles));
+    for (std::size_t i = 0; i < NumZones; i++) {
+      DbgPrintf("  %-16s %8lu %3lu%%  max %8lu %3lu%%\n", ZoneNames[i], static_cast<unsigned long>(last.zoneCycles[i]), ToPercent(last.zoneCycles[i]), static_cast<unsigned long>(max.zoneCycles[i]), ToPercent(max.zoneCycles[i]));
+    }
+
+    MemoryUsage::Dump();
+  }
+}   // namespace Profiler
+#endif
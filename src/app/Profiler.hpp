@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CycleCounter.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+
+// 1フレームの処理時間がどこで使われているかを測るためのプロファイラ
+// 測りたい範囲に Profiler::Zone<Profiler::ZoneId::X> を置くと、スコープの開始から終了までのサイクル数がフレームごとに積算される
+// ゾーンは包含的に数える（入れ子になったゾーンや、途中で割り込んだISRの時間も外側のゾーンに含まれる）
+// VBlank待ちの間に走るISRの時間は次のフレームに数える
+// RELEASE_BUILD では全て消える
+namespace Profiler {
+  enum class ZoneId {
+    Render,
+    Update,
+    UpdateGame,
+    RenderBoardTile,
+    VBlankISR,
+    MusicStep,
+    End,
+  };
+
+  constexpr std::size_t NumZones = static_cast<std::size_t>(ZoneId::End);
+
+  // 直近何フレーム分を残しておくか
+  constexpr std::size_t HistorySize = 64;
+  static_assert((HistorySize & (HistorySize - 1)) == 0);
+
+  struct FrameRecord {
+    std::array<std::uint32_t, NumZones> zoneCycles;
+    std::uint32_t frameCycles;    // VBlank待ち明けから次のVBlank待ちまで
+    bool overrun;                 // 処理中にVBlankを跨いだ（処理落ちした）
+  };
+
+#ifndef RELEASE_BUILD
+  void AddZoneCycles(ZoneId zoneId, std::uint32_t cycles);
+
+  template<ZoneId Id>
+  class Zone {
+    static_assert(Id < ZoneId::End);
+
+    std::uint32_t mBeginCycle;
+
+  public:
+    Zone() :
+      mBeginCycle(ReadCycleCounter())
+    {}
+
+    ~Zone() {
+      AddZoneCycles(Id, ReadCycleCounter() - mBeginCycle);
+    }
+
+    Zone(const Zone&) = delete;
+    Zone(Zone&&) = delete;
+    Zone& operator=(const Zone&) = delete;
+    Zone& operator=(Zone&&) = delete;
+  };
+
+  // VBlank待ちの直後と直前に呼ぶ
+  void BeginFrame();
+  void EndFrame();
+
+  // VBlank割り込みのたびに呼ぶ（処理落ちの検出用）
+  void NotifyVBlank();
+
+  // age = 0 が直前に終わったフレーム
+  const FrameRecord& GetFrameRecord(std::size_t age);
+
+  // 直前のフレームと直近 HistorySize フレームの最大値、MemoryUsage::Dump() を DbgPrintf で出力する
+  void Dump();
+#else
+  template<ZoneId Id>
+  class Zone {
+  public:
+    Zone() {}
+  };
+
+  inline void BeginFrame() {}
+  inline void EndFrame() {}
+  inline void NotifyVBlank() {}
+  inline void Dump() {}
+#endif
+}   // namespace Profiler
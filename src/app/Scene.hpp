@@ -1,21 +1,21 @@
 #pragma once
 
-#include "SceneManager.hpp"
+#include "SceneId.hpp"
 
 
 namespace Root {
+  class SceneManager;
+
+
+  // シーンは SceneManager の std::variant に直接置かれ、std::visit で呼ばれるので仮想関数は使わない
+  // 派生クラスは Render() と Update() を定義すること
   class Scene {
   protected:
     SceneManager& sceneManager;
 
     Scene(SceneManager& sceneManager);
+    ~Scene();
 
     void SetScene(SceneId sceneId);
-
-  public:
-    virtual ~Scene();
-
-    virtual void Render() = 0;
-    virtual void Update() = 0;
   };
 }   // namespace Root
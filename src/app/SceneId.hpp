@@ -0,0 +1,11 @@
+#pragma once
+
+
+namespace Root {
+  enum class SceneId {
+    Config,
+    GameTetra,
+    GameTetraRestart,
+    Title,
+  };
+}   // namespace Root
@@ -2,14 +2,18 @@
 #include "ConfigScene.hpp"
 #include "Config.hpp"
 #include "CopyVRAM.hpp"
+#include "FrameCounter.hpp"
 #include "GameConfig.hpp"
 #include "GameTetraScene.hpp"
 #include "GameTetraRestartScene.hpp"
 #include "MergePalette.hpp"
+#include "Profiler.hpp"
 #include "Scene.hpp"
+#include "ShadowOAM.hpp"
 #include "Sound.hpp"
 #include "TitleScene.hpp"
 #include "UpdateFromConfig.hpp"
+#include "VRAMUploadQueue.hpp"
 #include "Signal/KeyInputSignal.hpp"
 #include "Signal/OneShotSignalDecorator.hpp"
 #include "Signal/RepeatSignalDecorator.hpp"
@@ -26,28 +30,33 @@
 #include <cstddef>
 #include <cstring>
 #include <memory>
+#include <type_traits>
+#include <variant>
 
 
 namespace Root {
   SceneManager::~SceneManager() = default;
 
 
-  std::unique_ptr<Scene> SceneManager::CreateSceneFromSceneId(SceneId sceneId) {
+  void SceneManager::EmplaceSceneFromSceneId(SceneId sceneId) {
     switch (sceneId) {
       case SceneId::Title:
-        return std::make_unique<TitleScene>(*this);
+        mScene.emplace<TitleScene>(*this);
+        return;
 
       case SceneId::Config:
-        return std::make_unique<ConfigScene>(*this);
+        mScene.emplace<ConfigScene>(*this);
+        return;
 
       case SceneId::GameTetra:
-        return std::make_unique<GameTetraScene>(*this);
+        mScene.emplace<GameTetraScene>(*this);
+        return;
 
       case SceneId::GameTetraRestart:
-        return std::make_unique<GameTetraRestartScene>(*this);
+        mScene.emplace<GameTetraRestartScene>(*this);
+        return;
     }
     assert(false);
-    return nullptr;
   }
 
 
@@ -59,7 +68,7 @@ namespace Root {
 
   SceneManager::SceneManager(SceneId initialSceneId) :
     mSceneId(initialSceneId),
-    mPtrScene(),
+    mScene(),
     oneShotKeyInputA(
       std::make_unique<OneShotSignalDecorator>(
         std::make_unique<KeyInputSignal>(gba::KEYINPUT::A))),
@@ -94,39 +103,62 @@ namespace Root {
 
     gba::reg::DISPCNT = gba::DISPCNT::FORCE_BLANK;
 
-    BGCopyPalette(Config::MergedPaletteData);
-    BGCopyTile<Config::CharBase>(Tile::bg::TileData);
-    BGCopyTile<Config::BG3CharBase>(Tile::bg_background::TileData);
-    BGCopyMap<Config::ScrBase::BG3>(Tile::bg_background::BGBackgroundGray::MapData);
+    // タイルは LZ77 で圧縮してあるので、ここで BIOS で展開する（画面は FORCE_BLANK で、割り込みもまだ有効にしていない）
+    // マップは VBlank ごとに少しずつ転送し、パレットは最後に転送する
+    // パレットを転送するまでは全色が黒なので、転送途中の画面は見えない
+    ClearPalette();
 
-    OBJCopyPalette(Tile::obj::PaletteData);
-    OBJCopyTile(Tile::obj::TileData);
+    DecompressLZ77VRAM(gba::memory::VRAM_BGTILE<Config::CharBase>, Tile::bg::TileDataLZ77);
+    DecompressLZ77VRAM(gba::memory::VRAM_BGTILE<Config::BG3CharBase>, Tile::bg_background::TileDataLZ77);
+    DecompressLZ77VRAM(gba::memory::VRAM_OBJTILE32, Tile::obj::TileDataLZ77);
+
+    auto& vramUploadQueue = VRAMUploadQueue::GetInstance();
+    SetBGFromConfig();
+    vramUploadQueue.Enqueue(gba::memory::PALETTE_BG, Config::MergedPaletteData);
+    vramUploadQueue.Enqueue(gba::memory::PALETTE_OBJ, Tile::obj::PaletteData);
 
     gba::reg::BG3CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::BG3CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG3) | Config::Priority::BG3;
 
     // delay initialization
-    mPtrScene = CreateSceneFromSceneId(initialSceneId);
+    FrameCounter::SetRootScene(static_cast<unsigned int>(initialSceneId));
+    EmplaceSceneFromSceneId(initialSceneId);
 
     // enable interrupts
     gba::reg::IME = gba::IME::ENABLE;
+
+    FrameCounter::BeginFrame();
+    Profiler::BeginFrame();
   }
 
 
   void SceneManager::SetScene(SceneId sceneId) {
     // ensure that the old scene is destructed before the new scene is created
-    mPtrScene.reset();
+    mScene.emplace<std::monostate>();
     mSceneId = sceneId;
-    mPtrScene = CreateSceneFromSceneId(sceneId);
+    FrameCounter::SetRootScene(static_cast<unsigned int>(sceneId));
+    EmplaceSceneFromSceneId(sceneId);
   }
 
 
   void SceneManager::Render() {
-    mPtrScene->Render();
+    Profiler::Zone<Profiler::ZoneId::Render> profilerZone;
+
+    std::visit([] (auto& scene) {
+      if constexpr (!std::is_same_v<std::decay_t<decltype(scene)>, std::monostate>) {
+        scene.Render();
+      }
+    }, mScene);
   }
 
 
   void SceneManager::Update() {
-    mPtrScene->Update();
+    Profiler::Zone<Profiler::ZoneId::Update> profilerZone;
+
+    std::visit([] (auto& scene) {
+      if constexpr (!std::is_same_v<std::decay_t<decltype(scene)>, std::monostate>) {
+        scene.Update();
+      }
+    }, mScene);
 
     if (mSceneId != SceneId::GameTetra  && konamiCommandSignal.GetState()) {
       if (GameConfig::GetGlobalConfig().easterEgg) {
@@ -152,7 +184,18 @@ namespace Root {
     repeatKeyInputDown->Step();
 
     konamiCommandSignal.Step();
+  }
 
+
+  void SceneManager::WaitForVBlank() {
+    Profiler::EndFrame();
+    FrameCounter::EndFrame();
     gba::bios::VBlankIntrWait();
+    FrameCounter::BeginFrame();
+    Profiler::BeginFrame();
+
+    // VBlank に入った直後なので、ここでまとめて OAM と VRAM を更新する
+    ShadowOAM::GetInstance().Flush();
+    VRAMUploadQueue::GetInstance().Process();
   }
 }   // namespace Root
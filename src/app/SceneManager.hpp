@@ -1,29 +1,27 @@
 #pragma once
 
 #include <memory>
+#include <variant>
 
+#include "ConfigScene.hpp"
+#include "GameTetraRestartScene.hpp"
+#include "GameTetraScene.hpp"
+#include "SceneId.hpp"
+#include "TitleScene.hpp"
 #include "Signal/SignalBase.hpp"
 #include "Signal/KonamiCommandSignal.hpp"
 
 
 namespace Root {
-  enum class SceneId {
-    Config,
-    GameTetra,
-    GameTetraRestart,
-    Title,
-  };
-
-
-  class Scene;
-
-
   class SceneManager {
     static constexpr auto InitialSceneId = SceneId::Title;
 
+    // 今のシーン、シーンの種類は決まっているのでヒープを使わずにここに置く（std::monostate は作る前）
+    using SceneVariant = std::variant<std::monostate, ConfigScene, GameTetraScene, GameTetraRestartScene, TitleScene>;
+
 
     SceneId mSceneId;
-    std::unique_ptr<Scene> mPtrScene;
+    SceneVariant mScene;
 
   public:
     std::unique_ptr<SignalBase> oneShotKeyInputA;
@@ -37,7 +35,7 @@ namespace Root {
     KonamiCommandSignal konamiCommandSignal;
 
   private:
-    std::unique_ptr<Scene> CreateSceneFromSceneId(SceneId sceneId);
+    void EmplaceSceneFromSceneId(SceneId sceneId);
 
   public:
     SceneManager(const SceneManager&) = delete;
@@ -54,6 +52,9 @@ namespace Root {
     void Render();
     void Update();
 
+    // 1フレームの処理を終えて次のVBlankまで待つ
+    void WaitForVBlank();
+
   private:
     SceneManager(SceneId initialSceneId);
   };
@@ -0,0 +1,35 @@
+#include "ShadowOAM.hpp"
+
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+ShadowOAM::ShadowOAM() :
+  mOAM{},
+  mDirtyBegin(NumObjects),
+  mDirtyEnd(0)
+{
+  // 起動直後の OAM は 0 埋め（全 OBJ が表示状態）なので、最初の Flush() で全エントリを非表示にする
+  Disable(0, NumObjects);
+}
+
+
+ShadowOAM& ShadowOAM::GetInstance() {
+  static ShadowOAM shadowOAM;
+  return shadowOAM;
+}
+
+
+void ShadowOAM::Flush() {
+  if (mDirtyBegin >= mDirtyEnd) {
+    return;
+  }
+
+  static_assert(sizeof(gba::OBJAttr) % sizeof(std::uint32_t) == 0);
+
+  gba::DMA3Copy(&mOAM[mDirtyBegin], reinterpret_cast<void*>(gba::memory::OAM + mDirtyBegin * sizeof(gba::OBJAttr)), (mDirtyEnd - mDirtyBegin) * sizeof(gba::OBJAttr) / sizeof(std::uint32_t));
+
+  mDirtyBegin = NumObjects;
+  mDirtyEnd = 0;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+// OAM（128エントリ）の WRAM 上のコピー
+// OBJ の属性はすべてこちらに書き込み、Flush() で書き換えた範囲だけを DMA3 でまとめて OAM に転送する
+// 表示中に OAM を直接書き換えるとスプライトが画面の途中で変わってしまうので、Flush() は VBlank 中に呼ぶこと
+// （Root::SceneManager::WaitForVBlank() が VBlank 明けに毎フレーム呼んでいる）
+class ShadowOAM {
+public:
+  static constexpr unsigned int NumObjects = 128;
+
+private:
+  alignas(4) std::array<gba::OBJAttr, NumObjects> mOAM;
+
+  // 前回の Flush() 以降に書き換えられたエントリの範囲 [mDirtyBegin, mDirtyEnd)
+  unsigned int mDirtyBegin;
+  unsigned int mDirtyEnd;
+
+  ShadowOAM();
+
+  void MarkDirty(unsigned int first, unsigned int count) {
+    if (first < mDirtyBegin) {
+      mDirtyBegin = first;
+    }
+    if (first + count > mDirtyEnd) {
+      mDirtyEnd = first + count;
+    }
+  }
+
+public:
+  ShadowOAM(const ShadowOAM&) = delete;
+  ShadowOAM(ShadowOAM&&) = delete;
+  ShadowOAM& operator=(const ShadowOAM&) = delete;
+  ShadowOAM& operator=(ShadowOAM&&) = delete;
+
+  static ShadowOAM& GetInstance();
+
+  // 書き込み用の参照を返す（そのエントリは次の Flush() で転送される）
+  gba::OBJAttr& operator[](unsigned int objId) {
+    MarkDirty(objId, 1);
+    return mOAM[objId];
+  }
+
+  const gba::OBJAttr& Get(unsigned int objId) const {
+    return mOAM[objId];
+  }
+
+  void Disable(unsigned int objId) {
+    (*this)[objId].attr0 = gba::OBJATTR0::OBJ_DISABLE;
+  }
+
+  // objId が first から count 個のエントリをまとめて非表示にする
+  void Disable(unsigned int first, unsigned int count) {
+    MarkDirty(first, count);
+    for (unsigned int i = first; i < first + count; i++) {
+      mOAM[i].attr0 = gba::OBJATTR0::OBJ_DISABLE;
+    }
+  }
+
+  void Flush();
+};
@@ -1,4 +1,7 @@
 #include "SignalBase.hpp"
+#include "SignalPool.hpp"
+
+#include <cstddef>
 
 
 SignalBase::SignalBase() :
@@ -6,6 +9,16 @@ SignalBase::SignalBase() :
 {}
 
 
+void* SignalBase::operator new(std::size_t size) {
+  return SignalPool::GetInstance().Allocate(size);
+}
+
+
+void SignalBase::operator delete(void* ptr) {
+  SignalPool::GetInstance().Deallocate(ptr);
+}
+
+
 void SignalBase::Step() {
   mState = StepImpl();
 }
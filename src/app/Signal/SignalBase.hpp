@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 
 class SignalBase {
   bool mState;
@@ -12,6 +14,10 @@ protected:
 public:
   virtual ~SignalBase() = default;
 
+  // malloc の代わりに SignalPool から確保する
+  static void* operator new(std::size_t size);
+  static void operator delete(void* ptr);
+
   void Step();
   bool GetState() const;
 };
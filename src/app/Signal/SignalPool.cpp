@@ -0,0 +1,80 @@
+#include "SignalPool.hpp"
+#include "DelaySignalDecorator.hpp"
+#include "KeyInputSignal.hpp"
+#include "OneShotSignalDecorator.hpp"
+#include "RepeatSignalDecorator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+
+namespace {
+  constexpr std::size_t BlockSize = std::max({
+    sizeof(DelaySignalDecorator),
+    sizeof(KeyInputSignal),
+    sizeof(OneShotSignalDecorator),
+    sizeof(RepeatSignalDecorator),
+  });
+
+  struct Block {
+    alignas(std::max_align_t) std::byte data[BlockSize];
+  };
+
+  std::array<Block, SignalPool::Capacity> gBlocks;
+
+
+  bool IsInPool(const void* ptr) {
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    return address >= reinterpret_cast<std::uintptr_t>(gBlocks.data()) && address < reinterpret_cast<std::uintptr_t>(gBlocks.data() + gBlocks.size());
+  }
+}
+
+
+SignalPool::SignalPool() :
+  mFreeList(nullptr)
+{
+  for (auto& block : gBlocks) {
+    Deallocate(block.data);
+  }
+}
+
+
+SignalPool& SignalPool::GetInstance() {
+  static SignalPool signalPool;
+  return signalPool;
+}
+
+
+void* SignalPool::Allocate(std::size_t size) {
+  assert(size <= BlockSize);
+  assert(mFreeList);
+
+  // Capacity か BlockSize の見積もりが外れていたら（RELEASE_BUILD）、nullptr を返さずにヒープから確保する
+  if (size > BlockSize || !mFreeList) {
+    return ::operator new(size);
+  }
+
+  const auto block = mFreeList;
+  mFreeList = block->next;
+  return block;
+}
+
+
+void SignalPool::Deallocate(void* ptr) {
+  if (!ptr) {
+    return;
+  }
+
+  if (!IsInPool(ptr)) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  const auto block = static_cast<FreeBlock*>(ptr);
+  block->next = mFreeList;
+  mFreeList = block;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+
+// シグナル（SignalBase の派生クラス）を置く固定長ブロックのプール
+// SignalBase::operator new / delete から使うので、std::make_unique でデコレータを連ねるところはそのまま
+// ブロックの大きさはデコレータとキー入力のうち一番大きいもの（SignalPool.cpp）で、同時に Capacity 個まで
+// 空きブロックは単方向リストで持つので、確保も解放も定数時間で断片化もしない
+// 空きがなくなったときはヒープから確保する（デバッグビルドでは assert で止める）
+class SignalPool {
+public:
+  // Root::SceneManager（16）+ GameTetra::GameScene（24）+ GameTetra の上に重ねるシーン（最大 4）
+  static constexpr std::size_t Capacity = 48;
+
+private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  FreeBlock* mFreeList;
+
+  SignalPool();
+
+public:
+  SignalPool(const SignalPool&) = delete;
+  SignalPool(SignalPool&&) = delete;
+  SignalPool& operator=(const SignalPool&) = delete;
+  SignalPool& operator=(SignalPool&&) = delete;
+
+  static SignalPool& GetInstance();
+
+  void* Allocate(std::size_t size);
+  void Deallocate(void* ptr);
+};
@@ -1,5 +1,6 @@
 #include "MusicManager.hpp"
 #include "../DbgPrintf.hpp"
+#include "../Profiler.hpp"
 
 #include <cassert>
 #include <cstdint>
@@ -134,7 +135,9 @@ void MusicManager::Resume() {
 }
 
 
-void MusicManager::Step() {
+IWRAM_CODE void MusicManager::Step() {
+  Profiler::Zone<Profiler::ZoneId::MusicStep> profilerZone;
+
   //DbgPrintf("c: %08x, l: %08x, e: %08x, p: %d, t: %d -> %d\n", (std::uintptr_t)mPtrCurrent, (std::uintptr_t)mPtrLoopPoint, (std::uintptr_t)mPtrEnd, mPlaying ? 1 : 0, mCurrentTick, mNextTick);
   if (!mPlaying) {
     return;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <gba.hpp>
 
 
 class MusicManager {
@@ -33,5 +34,5 @@ public:
   void Stop();
   void Resume();
 
-  void Step();
+  IWRAM_CODE void Step();
 };
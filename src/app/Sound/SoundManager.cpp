@@ -126,7 +126,7 @@ void SoundManager::Stop() {
 }
 
 
-std::uint_fast16_t SoundManager::IRQ(std::uint_fast16_t flag) {
+IWRAM_CODE std::uint_fast16_t SoundManager::IRQ(std::uint_fast16_t flag) {
   auto handleIRQ = [this, flag] (Channel channel) -> std::uint_fast16_t {
     struct ChannelSpec {
       std::uint_fast16_t dmaFlag;
@@ -35,5 +35,5 @@ public:
   void Stop(Channel channel);
   void Stop();
 
-  std::uint_fast16_t IRQ(std::uint_fast16_t flag = gba::reg::IE);
+  IWRAM_CODE std::uint_fast16_t IRQ(std::uint_fast16_t flag = gba::reg::IE);
 };
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+
+// コンパイル時に決まる領域の割り当て（VRAM のブロックや OAM のエントリ）
+//
+// 使う側は要求を StaticRequest を継承した型として宣言し、StaticLayout<容量, 要求...> に並べる
+// 要求は並べた順に、先頭から空いている所（Alignment の倍数の位置）に詰めて割り当てる
+// 容量が足りなければコンパイルエラーになる
+//
+//   struct Foo : StaticRequest<2> {};
+//   struct Bar : StaticRequest<4, 4> {};
+//   using Layout = StaticLayout<32, Foo, Bar>;
+//   constexpr auto bar = Layout::Offset<Bar>();    // 4
+template<std::size_t N, std::size_t A = 1>
+struct StaticRequest {
+  static constexpr std::size_t Count = N;
+  static constexpr std::size_t Alignment = A;
+
+  static_assert(A != 0);
+};
+
+
+template<std::size_t Capacity, typename... Requests>
+class StaticLayout {
+  static constexpr std::size_t NumRequests = sizeof...(Requests);
+
+  // 割り当てられなかった要求の位置
+  static constexpr std::size_t Invalid = Capacity;
+
+  static constexpr std::array<std::size_t, NumRequests> Allocate() {
+    constexpr std::array<std::size_t, NumRequests> counts{Requests::Count...};
+    constexpr std::array<std::size_t, NumRequests> alignments{Requests::Alignment...};
+
+    std::array<bool, Capacity> used{};
+    std::array<std::size_t, NumRequests> offsets{};
+    for (std::size_t i = 0; i < NumRequests; i++) {
+      offsets[i] = Invalid;
+      for (std::size_t offset = 0; offset + counts[i] <= Capacity; offset += alignments[i]) {
+        bool isFree = true;
+        for (std::size_t j = offset; j < offset + counts[i]; j++) {
+          if (used[j]) {
+            isFree = false;
+            break;
+          }
+        }
+        if (!isFree) {
+          continue;
+        }
+
+        for (std::size_t j = offset; j < offset + counts[i]; j++) {
+          used[j] = true;
+        }
+        offsets[i] = offset;
+        break;
+      }
+    }
+    return offsets;
+  }
+
+  static constexpr std::array<std::size_t, NumRequests> Offsets = Allocate();
+
+  static constexpr bool AllocatedAll() {
+    for (const auto offset : Offsets) {
+      if (offset == Invalid) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static_assert(AllocatedAll(), "out of capacity");
+
+  template<typename Request>
+  static constexpr std::size_t IndexOf() {
+    constexpr std::array<bool, NumRequests> matches{std::is_same_v<Request, Requests>...};
+
+    std::size_t index = NumRequests;
+    for (std::size_t i = 0; i < NumRequests; i++) {
+      if (matches[i]) {
+        index = i;
+      }
+    }
+    return index;
+  }
+
+  static constexpr bool HasNoDuplicates() {
+    constexpr std::array<std::size_t, NumRequests> indices{IndexOf<Requests>()...};
+
+    for (std::size_t i = 0; i < NumRequests; i++) {
+      if (indices[i] != i) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static_assert(HasNoDuplicates(), "the same request appears twice");
+
+public:
+  template<typename Request>
+  static constexpr std::size_t Offset() {
+    constexpr std::size_t index = IndexOf<Request>();
+    static_assert(index != NumRequests, "not requested in this layout");
+
+    return Offsets[index];
+  }
+
+  // 使っている範囲の末尾（これ以降は空いている）
+  static constexpr std::size_t End() {
+    constexpr std::array<std::size_t, NumRequests> counts{Requests::Count...};
+
+    std::size_t end = 0;
+    for (std::size_t i = 0; i < NumRequests; i++) {
+      if (Offsets[i] + counts[i] > end) {
+        end = Offsets[i] + counts[i];
+      }
+    }
+    return end;
+  }
+};
@@ -6,9 +6,12 @@
 #include <image/bg.hpp>
 #include <image/obj.hpp>
 
+#include "../VRAMLayout.hpp"
+
 
 namespace GameTetra::Config {
-#ifndef RELEASE_BUILD
+  // デバッグ盤面はデバッグビルドのほか、DEBUG_BOARD を指定すればリリースビルドでも使える（ベンチマーク用）
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
   namespace Debug {
     enum class DebugBoardType {
       None = 0,
@@ -18,7 +21,12 @@ namespace GameTetra::Config {
       REN,
     };
 
+    // ベンチマーク等でビルド時に -DDEBUG_BOARD=QuadTST のように指定できる
+#ifdef DEBUG_BOARD
+    constexpr DebugBoardType DebugBoard = DebugBoardType::DEBUG_BOARD;
+#else
     constexpr DebugBoardType DebugBoard = DebugBoardType::None;
+#endif
   }   // namespace Debug
 #endif
 
@@ -50,60 +58,35 @@ namespace GameTetra::Config {
     constexpr unsigned int LinesToNextLevel = 10;
   }   // namespace Board
 
-  constexpr std::uint16_t CharBase = 0;
+  // 配置は VRAMLayout で決める
+  constexpr std::uint16_t CharBase = VRAMLayout::BG::CharBaseBlock<VRAMLayout::BG::CommonTiles>;
 
   namespace ScrBase {
-    // 0 ~ 7 are reserved for Tile 0
-    // 8 ~ 23 are reserved for Tile 1
-    // 24 is reserved for BG3
-
-    constexpr std::uint16_t BG0Score  = 25;
-    constexpr std::uint16_t BG0Result = 25;
-    constexpr std::uint16_t BG1Game   = 26;
-    constexpr std::uint16_t BG1Ready  = 27;
-    constexpr std::uint16_t BG1Pause  = 28;
-    constexpr std::uint16_t BG2       = 29;   // Frame
+    constexpr std::uint16_t BG0Score    = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::TextMap>;
+    constexpr std::uint16_t BG0Result   = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::TextMap>;
+    constexpr std::uint16_t BG1Game     = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::BoardMap>;
+    constexpr std::uint16_t BG1Ready    = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::ReadyMap>;
+    constexpr std::uint16_t BG1Pause    = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::PauseMap>;
+    constexpr std::uint16_t BG2         = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::FrameMap>;       // Frame
+    constexpr std::uint16_t BG1GameBack = VRAMLayout::BG::ScreenBaseBlock<VRAMLayout::BG::BoardBackMap>;   // BG1Game の裏（盤面をダブルバッファにするとき）
   }   // namespace ScrBase
 
   namespace ObjId {
-    // 10 ~ 13 : Perfect Clear, Back To Back, Tetris
-
-    constexpr std::uint16_t PerfectClearLeft  = 10;
-    constexpr std::uint16_t PerfectClearRight = 11;
-    constexpr std::uint16_t BackToBack        = 12;
-    constexpr std::uint16_t Tetris            = 13;
-
-    // 15 ~ 18 : REN
-    namespace Ren {
-      constexpr std::uint16_t Ren     = 15;
-      constexpr std::uint16_t Digit1  = 16;
-      constexpr std::uint16_t Digit21 = 17;
-      constexpr std::uint16_t Digit22 = 18;
-    }   // namespace Ren
-
-    // 20 ~ 22 : T-Spin
-
-    namespace TSpin {
-      constexpr std::uint16_t TSpin   = 20;
-      constexpr std::uint16_t Mini    = 21;
-      constexpr std::uint16_t SDT     = 22;
-    }   // namespace TSpin
-
-    // 30 ~ 62 : LineClear Animation
-
-    constexpr std::uint16_t LineClearFirstLeft        = 30;
-    constexpr std::uint16_t LineClearFirstRight       = 31;
-    constexpr std::uint16_t LineClearFirstMiddleFirst = 32;
+    // エフェクト（EffectPool が空いているものから割り当てる）
+    constexpr std::uint16_t EffectFirst = VRAMLayout::OAM::ObjId<VRAMLayout::OAM::Effects>;
+    constexpr std::size_t   NumEffects  = VRAMLayout::OAM::Effects::Count;
+
+    // ライン消去アニメ、1行あたり左端、右端、中央 NumLineClearMiddle 個
+    constexpr std::uint16_t LineClearFirstLeft        = VRAMLayout::OAM::ObjId<VRAMLayout::OAM::LineClear>;
+    constexpr std::uint16_t LineClearFirstRight       = LineClearFirstLeft + 1;
+    constexpr std::uint16_t LineClearFirstMiddleFirst = LineClearFirstLeft + 2;
     constexpr std::uint16_t NumLineClearMiddle        = 5;
-    constexpr std::uint16_t LineClearDiff             = 8;
-
-    // 80 : Hold Mino
-
-    constexpr std::uint16_t HoldMino      = 80;
+    constexpr std::uint16_t LineClearDiff             = 2 + NumLineClearMiddle;
 
-    // 90 ~ 95 : Next Minos
+    constexpr std::uint16_t HoldMino      = VRAMLayout::OAM::ObjId<VRAMLayout::OAM::HoldMino>;
 
-    constexpr std::uint16_t NextMinoFirst = 90;
+    constexpr std::uint16_t NextMinoFirst = VRAMLayout::OAM::ObjId<VRAMLayout::OAM::NextMinos>;
+    static_assert(VRAMLayout::OAM::NextMinos::Count == Board::NumNexts);
   }   // namespace ObjId
 
   namespace Priority {
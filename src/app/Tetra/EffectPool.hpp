@@ -0,0 +1,133 @@
+#pragma once
+
+#include "../ShadowOAM.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+namespace GameTetra {
+  // 一定時間表示して消える OBJ（T-Spin や REN などの文字）の定義
+  struct EffectInfo {
+    using GroupMask = std::uint_fast8_t;
+
+    // aliveFrame がこれなら Hide() されるまで表示し続ける
+    static constexpr unsigned int Forever = 0;
+
+    unsigned int x;
+    unsigned int y;
+    unsigned int aliveFrame;
+    std::uint16_t attr0Base;
+    std::uint16_t attr1Base;
+    std::uint16_t attr2Base;
+    GroupMask group;              // 属するグループ（1ビット）
+    GroupMask hides;              // 表示する前に消すグループ（同じグループを含めれば置き換えになる）
+  };
+
+
+  // エフェクトの OBJ のプール
+  // OAM の FirstObjId から Capacity 個のうち空いているものを割り当て、Step() で毎フレーム寿命を減らして切れたら消す
+  // スロットの状態は項目ごとの配列に持ち、Step() は使用中のビットを舐めるだけのループになっている
+  // 位置や属性は表示するときに OAM に書くだけなので EffectInfo（定数のテーブル）に置いたままにする
+  template<std::uint_fast16_t FirstObjId, std::size_t Capacity>
+  class EffectPool {
+    using Mask = std::uint32_t;
+    static_assert(Capacity <= sizeof(Mask) * 8);
+
+    // mRemainingFrames の値、寿命がない
+    static constexpr std::uint16_t NoLimit = 0xFFFF;
+
+    Mask mActiveMask;                                           // bit i = スロット i を使用中
+    std::array<std::uint16_t, Capacity> mRemainingFrames;       // 消えるまでのフレーム数
+    std::array<EffectInfo::GroupMask, Capacity> mGroups;
+
+    void Free(unsigned int slot) {
+      ShadowOAM::GetInstance().Disable(FirstObjId + slot);
+      mActiveMask &= ~(Mask{1} << slot);
+    }
+
+  public:
+    EffectPool() :
+      mActiveMask(0),
+      mRemainingFrames{},
+      mGroups{}
+    {}
+
+    EffectPool(const EffectPool&) = delete;
+    EffectPool& operator=(const EffectPool&) = delete;
+
+    ~EffectPool() {
+      Clear();
+    }
+
+    void Show(const EffectInfo& info) {
+      Show(info, info.attr2Base);
+    }
+
+    // attr2 はタイルを差し替えるとき（数字など）
+    void Show(const EffectInfo& info, std::uint16_t attr2) {
+      assert(info.aliveFrame < NoLimit);
+
+      if (info.hides) {
+        Hide(info.hides);
+      }
+
+      unsigned int slot = 0;
+      while (slot < Capacity && (mActiveMask & (Mask{1} << slot))) {
+        slot++;
+      }
+      assert(slot < Capacity);
+      if (slot == Capacity) {
+        return;
+      }
+
+      mActiveMask |= Mask{1} << slot;
+      mRemainingFrames[slot] = info.aliveFrame == EffectInfo::Forever ? NoLimit : info.aliveFrame;
+      mGroups[slot] = info.group;
+
+      auto& objAttr = ShadowOAM::GetInstance()[FirstObjId + slot];
+      objAttr.attr0 = info.attr0Base | gba::OBJATTR0::Y(info.y);
+      objAttr.attr1 = info.attr1Base | gba::OBJATTR1::X(info.x);
+      objAttr.attr2 = attr2;
+    }
+
+    // groups のいずれかに属するエフェクトを消す
+    void Hide(EffectInfo::GroupMask groups) {
+      unsigned int slot = 0;
+      for (Mask mask = mActiveMask; mask; mask >>= 1, slot++) {
+        if ((mask & 1) && (mGroups[slot] & groups)) {
+          Free(slot);
+        }
+      }
+    }
+
+    void Clear() {
+      unsigned int slot = 0;
+      for (Mask mask = mActiveMask; mask; mask >>= 1, slot++) {
+        if (mask & 1) {
+          Free(slot);
+        }
+      }
+    }
+
+    // 1フレーム進める、aliveFrame フレーム表示したものは消す
+    void Step() {
+      unsigned int slot = 0;
+      for (Mask mask = mActiveMask; mask; mask >>= 1, slot++) {
+        if (!(mask & 1) || mRemainingFrames[slot] == NoLimit) {
+          continue;
+        }
+
+        if (mRemainingFrames[slot] == 0) {
+          Free(slot);
+        } else {
+          mRemainingFrames[slot]--;
+        }
+      }
+    }
+  };
+}   // namespace GameTetra
@@ -15,6 +15,7 @@
 #include "../Sound/MusicManager.hpp"
 #include "../Sound/SoundManager.hpp"
 
+#include <cstring>
 #include <memory>
 #include <gba.hpp>
 #include <image/bg.hpp>
@@ -27,6 +28,7 @@ namespace GameTetra {
     mType(type),
     mPage(0),
     mFrameCountForKeyInput(0),
+    mResultBox(Config::ClearOver::StatsX, Config::ClearOver::StatsY),
     mKeyInputRight(
       std::make_unique<OneShotSignalDecorator>(
         std::make_unique<KeyInputSignal>(gba::KEYINPUT::RIGHT))),
@@ -51,6 +53,8 @@ namespace GameTetra {
 
     MusicManager::GetInstance().Play(Song::gameover);
 
+    SetResultPage();
+
     sceneManager.GameRender();
   }
 
@@ -66,53 +70,65 @@ namespace GameTetra {
 
 
   void GameEndSceneBase::Render() {
+    mResultBox.Render();
+  }
+
+
+  void GameEndSceneBase::SetResultPage() {
     const auto& statistics = sceneManager.GetGameScene().GetGame().GetGameStatistics();
 
-    unsigned int y = Config::ClearOver::StatsY;
-    const auto PrintResultLine = [&y] (const char* key, Tetra::Game::GameStatistics::Count value, const char* spec = "%-13s %4d") {
-      static char buffer[32];
-      std::snprintf(buffer, sizeof(buffer), spec, key, static_cast<unsigned int>(value));
-      TilePrint<Config::ScrBase::BG0Result>(buffer, Config::ClearOver::StatsX, y);
-      y++;
+    unsigned int row = 0;
+    const auto SetResultLine = [this, &row] (const char* key, Tetra::Game::GameStatistics::Count value, unsigned int valueWidth = 4) {
+      char line[ResultLineWidth + 1];
+      std::memset(line, ' ', ResultLineWidth);
+      std::memcpy(line, key, std::strlen(key));
+      FormatNumber(line + ResultLineWidth - valueWidth, static_cast<unsigned int>(value), valueWidth);
+      mResultBox.SetLine(row, line);
+      row++;
+    };
+    const auto SetBlankLines = [this, &row] (unsigned int count) {
+      for (unsigned int i = 0; i < count; i++) {
+        mResultBox.SetLine(row, "");
+        row++;
+      }
     };
 
-    BGClearMap<Config::ScrBase::BG0Result, 32, 0, Config::ClearOver::StatsY, gba::lcd::TileVirtualWidth, gba::lcd::TileVirtualHeight - Config::ClearOver::StatsY>();
-
-    PrintResultLine("Score", sceneManager.GetGameScene().GetScore(), "%s %12d");
+    SetResultLine("Score", sceneManager.GetGameScene().GetScore(), 12);
     if (sceneManager.GetGameScene().GetExtremeMode()) {
-      PrintResultLine("Level", 0, "%-10s EXTREME");
+      mResultBox.SetLine(row, "Level      EXTREME");
+      row++;
     } else {
-      PrintResultLine("Level", sceneManager.GetGameScene().GetLevel());
+      SetResultLine("Level", sceneManager.GetGameScene().GetLevel());
     }
-    PrintResultLine("Total Lines", statistics.numClearedLines);
-    y += 2;
+    SetResultLine("Total Lines", statistics.numClearedLines);
+    SetBlankLines(2);
 
     switch (mPage) {
       case 0:
-        PrintResultLine("Single", statistics.numSingles);
-        PrintResultLine("Double", statistics.numDoubles);
-        PrintResultLine("Triple", statistics.numTriples);
-        PrintResultLine("Tetris", statistics.numQuadruples);
-        y++;
-
-        PrintResultLine("Max REN", statistics.numMaxRens);
-        PrintResultLine("Back-to-Back", statistics.numTotalBackToBacks);
-        PrintResultLine("Perfect Clear", statistics.numPerfectClears);
-        y++;
+        SetResultLine("Single", statistics.numSingles);
+        SetResultLine("Double", statistics.numDoubles);
+        SetResultLine("Triple", statistics.numTriples);
+        SetResultLine("Tetris", statistics.numQuadruples);
+        SetBlankLines(1);
+
+        SetResultLine("Max REN", statistics.numMaxRens);
+        SetResultLine("Back-to-Back", statistics.numTotalBackToBacks);
+        SetResultLine("Perfect Clear", statistics.numPerfectClears);
         break;
 
       case 1:
-        PrintResultLine("T-Spin", statistics.numTSpinZeros);
-        PrintResultLine("T-Spin Mini", statistics.numTSpinMiniZeros + statistics.numTSpinMiniSingles + statistics.numTSpinMiniDoubles);
-        PrintResultLine("T-Spin Single", statistics.numTSpinSingles);
-        PrintResultLine("T-Spin Double", statistics.numTSpinDoubles);
-        PrintResultLine("T-Spin Triple", statistics.numTSpinTriples);
-        y++;
-
-        PrintResultLine("T-Spin Total", statistics.numAllTSpins);
-        y++;
+        SetResultLine("T-Spin", statistics.numTSpinZeros);
+        SetResultLine("T-Spin Mini", statistics.numTSpinMiniZeros + statistics.numTSpinMiniSingles + statistics.numTSpinMiniDoubles);
+        SetResultLine("T-Spin Single", statistics.numTSpinSingles);
+        SetResultLine("T-Spin Double", statistics.numTSpinDoubles);
+        SetResultLine("T-Spin Triple", statistics.numTSpinTriples);
+        SetBlankLines(1);
+
+        SetResultLine("T-Spin Total", statistics.numAllTSpins);
         break;
     }
+
+    SetBlankLines(NumResultLines - row);
   }
 
 
@@ -133,6 +149,8 @@ namespace GameTetra {
         return;
       }
 
+      const unsigned int previousPage = mPage;
+
       if (mKeyInputRight->GetState()) {
         mPage++;
         if (mPage == NumPages) {
@@ -147,6 +165,10 @@ namespace GameTetra {
           mPage--;
         }
       }
+
+      if (mPage != previousPage) {
+        SetResultPage();
+      }
     }
 
     mKeyInputRight->Step();
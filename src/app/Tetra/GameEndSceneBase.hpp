@@ -2,7 +2,9 @@
 
 #include <memory>
 
+#include "Config.hpp"
 #include "Scene.hpp"
+#include "../TileUI.hpp"
 #include "../Signal/SignalBase.hpp"
 
 
@@ -17,18 +19,28 @@ namespace GameTetra {
   private:
     static constexpr unsigned int NumPages = 2;
 
+    // 1行は「見出し（左詰め） 値（右詰め）」
+    static constexpr unsigned int ResultLineWidth = 18;
+    static constexpr unsigned int NumResultLines = 13;
+
     Type mType;
     unsigned int mPage;
     unsigned int mFrameCountForKeyInput;
 
+    // ページを切り替えても変わらない行は描き直されない
+    TileUI::TextBox<Config::ScrBase::BG0Result, ResultLineWidth, NumResultLines> mResultBox;
+
     std::unique_ptr<SignalBase> mKeyInputRight;
     std::unique_ptr<SignalBase> mKeyInputLeft;
 
   public:
     GameEndSceneBase(SceneManager& sceneManager, Type type);
-    virtual ~GameEndSceneBase();
+    ~GameEndSceneBase();
 
-    virtual void Render() override;
-    virtual void Update() override;
+    void Render();
+    void Update();
+
+  private:
+    void SetResultPage();
   };
 }   // namespace GameTetra
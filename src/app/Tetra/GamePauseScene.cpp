@@ -1,6 +1,7 @@
 #include "GamePauseScene.hpp"
 #include "SceneManager.hpp"
 #include "Config.hpp"
+#include "GameScene.hpp"
 #include "../DbgPrintf.hpp"
 #include "../SceneManager.hpp"
 #include "../Signal/DelaySignalDecorator.hpp"
@@ -20,6 +21,7 @@ namespace GameTetra {
     DbgPrintf("ctor of GameTetra::GamePauseScene\n");
 
     gba::reg::SOUNDCNT_L = (gba::reg::SOUNDCNT_L & 0xFF00) | gba::SOUNDCNT_L::VOLUMERL(Config::Pause::SoundVolume);
+    sceneManager.GetGameScene().SetBoardVisible(false);
     gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG1Pause) | Config::Priority::BG1;
     gba::reg::DISPCNT &= ~gba::DISPCNT::OBJ;
 
@@ -34,7 +36,7 @@ namespace GameTetra {
     DbgPrintf("dtor of GameTetra::GamePauseScene\n");
 
     gba::reg::SOUNDCNT_L = mSOUNDCNT_L;
-    gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG1Game) | Config::Priority::BG1;
+    sceneManager.GetGameScene().SetBoardVisible(true);
     gba::reg::DISPCNT |= gba::DISPCNT::OBJ;
     gba::reg::BLDCNT = gba::BLDCNT::NONE;
   }
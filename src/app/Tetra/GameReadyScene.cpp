@@ -7,6 +7,7 @@
 #include "../DbgPrintf.hpp"
 #include "../Sound.hpp"
 #include "../SceneManager.hpp"
+#include "../ShadowOAM.hpp"
 #include "../Sound/MusicManager.hpp"
 #include "../Sound/SoundManager.hpp"
 
@@ -29,6 +30,7 @@ namespace GameTetra {
 
     BGClearMap<Config::ScrBase::BG1Ready>();
 
+    sceneManager.GetGameScene().SetBoardVisible(false);
     gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG1Ready) | Config::Priority::BG1;
 
     MusicManager::GetInstance().Stop();
@@ -38,7 +40,7 @@ namespace GameTetra {
   GameReadyScene::~GameReadyScene() {
     DbgPrintf("dtor of GameTetra::GameReadyScene\n");
 
-    gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG1Game) | Config::Priority::BG1;
+    sceneManager.GetGameScene().SetBoardVisible(true);
 
     MusicManager::GetInstance().Resume();
   }
@@ -53,7 +55,7 @@ namespace GameTetra {
       const auto mino = i ? boardInfo.nextMinos[i - 1] : boardInfo.currentMino;
       const unsigned int minoTileIndex = Tile::obj::Mino::TileIndex + static_cast<unsigned int>(mino) * Tile::obj::Mino::MapWidth * Tile::obj::Mino::MapHeight;
 
-      volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::NextMinoFirst + i];
+      auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::NextMinoFirst + i];
 
       objAttr.attr0 = Tile::obj::Mino::Attribute0Base | gba::OBJATTR0::Y(Config::Position::NextY + Config::Position::NextH * i);
       objAttr.attr1 = Tile::obj::Mino::Attribute1Base | gba::OBJATTR1::X(Config::Position::NextX);
@@ -78,7 +80,9 @@ namespace GameTetra {
     }
 
     if (mFrameCount >= TargetFrameCount3) {
+      // this scene is destructed here
       SetScene(SceneId::Game);
+      return;
     }
 
     mFrameCount++;
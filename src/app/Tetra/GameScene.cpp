@@ -4,11 +4,14 @@
 #include "Tetra/Game.hpp"
 #include "../DbgPrintf.hpp"
 #include "../GameConfig.hpp"
+#include "../Profiler.hpp"
 #include "../SceneManager.hpp"
+#include "../ShadowOAM.hpp"
 #include "../Song.hpp"
 #include "../Sound.hpp"
 #include "../TilePrint.hpp"
 #include "../UpdateFromConfig.hpp"
+#include "../VRAMLayout.hpp"
 #include "../Signal/SignalBase.hpp"
 #include "../Signal/KeyInputSignal.hpp"
 #include "../Signal/DelaySignalDecorator.hpp"
@@ -21,7 +24,7 @@
 
 #include <array>
 #include <cstddef>
-#include <cstdio>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -50,14 +53,122 @@ namespace GameTetra {
     })();
 
 
-    inline void DisableObject(unsigned int objId) {
-      volatile auto& objAttr = gba::pointer_memory::OAM[objId];
-      objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
+    // 盤面（Tetra::Game の mBlocks など）、Collide() で毎回読むので IWRAM に置く
+    // GameScene は同時に1つしか存在しない（SceneManager は前のシーンを破棄してから次を作る）
+    IWRAM_DATA std::array<Tetra::BlockType, Tetra::Game::Game::NumBlockBuffers * Config::Board::WidthIncludingBorder * Config::Board::HeightIncludingBorder> gBoardBlockStorage{};
+
+
+    static_assert(VRAMLayout::OAM::LineClear::Count == Config::ObjId::LineClearDiff * Tetra::MaxMinoSize);
+
+    // all objects of the line clear animation
+    inline void DisableLineClearObjects() {
+      ShadowOAM::GetInstance().Disable(Config::ObjId::LineClearFirstLeft, Config::ObjId::LineClearDiff * Tetra::MaxMinoSize);
+    }
+
+
+    namespace EffectGroup {
+      constexpr EffectInfo::GroupMask TSpin        = 1 << 0;
+      constexpr EffectInfo::GroupMask Tetris       = 1 << 1;
+      constexpr EffectInfo::GroupMask Ren          = 1 << 2;
+      constexpr EffectInfo::GroupMask BackToBack   = 1 << 3;
+      constexpr EffectInfo::GroupMask PerfectClear = 1 << 4;
+    }   // namespace EffectGroup
+
+    enum class EffectType {
+      TSpin,
+      TSpinMini,
+      TSpinSDT,
+      Tetris,
+      Ren,
+      RenDigit1,
+      RenDigit21,
+      RenDigit22,
+      BackToBack,
+      PerfectClearLeft,
+      PerfectClearRight,
+      End,
+    };
+
+    // エフェクトの表示位置、表示時間と重なりの規則
+    // T-Spin と Tetris は同じ位置に出るので、片方を出すともう片方は消える
+    // グループの先頭（T-Spin、REN、Perfect Clear の左）が前のグループごと置き換えるので、続く Mini、数字などはその後に出すこと
+    constexpr std::array<EffectInfo, static_cast<std::size_t>(EffectType::End)> EffectInfos{{
+      // TSpin
+      {
+        Config::Position::Effect::TSpinX, Config::Position::Effect::TSpinY, Config::Frame::Effect::TSpinAlive,
+        Tile::obj::TSpin::Attribute0Base, Tile::obj::TSpin::Attribute1Base, Tile::obj::TSpin::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::TSpin, EffectGroup::TSpin | EffectGroup::Tetris,
+      },
+      // TSpinMini
+      {
+        Config::Position::Effect::MiniX, Config::Position::Effect::MiniY, Config::Frame::Effect::TSpinAlive,
+        Tile::obj::Mini::Attribute0Base, Tile::obj::Mini::Attribute1Base, Tile::obj::Mini::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::TSpin, 0,
+      },
+      // TSpinSDT（attr2 は SINGLE/DOUBLE/TRIPLE で差し替える）
+      {
+        Config::Position::Effect::TSpinSDTX, Config::Position::Effect::TSpinSDTY, Config::Frame::Effect::TSpinAlive,
+        Tile::obj::Single::Attribute0Base, Tile::obj::Single::Attribute1Base, Tile::obj::Single::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::TSpin, 0,
+      },
+      // Tetris
+      {
+        Config::Position::Effect::TetrisX, Config::Position::Effect::TetrisY, Config::Frame::Effect::TetrisAlive,
+        Tile::obj::Tetris::Attribute0Base, Tile::obj::Tetris::Attribute1Base, Tile::obj::Tetris::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::Tetris, EffectGroup::Tetris | EffectGroup::TSpin,
+      },
+      // Ren
+      {
+        Config::Position::Effect::RenX, Config::Position::Effect::RenY, Config::Frame::Effect::RenAlive,
+        Tile::obj::Ren::Attribute0Base, Tile::obj::Ren::Attribute1Base, Tile::obj::Ren::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::Ren, EffectGroup::Ren,
+      },
+      // RenDigit1（attr2 は数字で差し替える）
+      {
+        Config::Position::Effect::RenDigit1X, Config::Position::Effect::RenDigitY, Config::Frame::Effect::RenAlive,
+        Tile::obj::Number::Attribute0Base, Tile::obj::Number::Attribute1Base, Tile::obj::Number::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::Ren, 0,
+      },
+      // RenDigit21
+      {
+        Config::Position::Effect::RenDigit21X, Config::Position::Effect::RenDigitY, Config::Frame::Effect::RenAlive,
+        Tile::obj::Number::Attribute0Base, Tile::obj::Number::Attribute1Base, Tile::obj::Number::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::Ren, 0,
+      },
+      // RenDigit22
+      {
+        Config::Position::Effect::RenDigit22X, Config::Position::Effect::RenDigitY, Config::Frame::Effect::RenAlive,
+        Tile::obj::Number::Attribute0Base, Tile::obj::Number::Attribute1Base, Tile::obj::Number::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::Ren, 0,
+      },
+      // BackToBack
+      {
+        Config::Position::Effect::BackToBackX, Config::Position::Effect::BackToBackY, Config::Frame::Effect::BackToBackAlive,
+        Tile::obj::BackToBack::Attribute0Base, Tile::obj::BackToBack::Attribute1Base, Tile::obj::BackToBack::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::BackToBack, EffectGroup::BackToBack,
+      },
+      // PerfectClearLeft
+      {
+        Config::Position::Effect::PerfectClearLeftX, Config::Position::Effect::PerfectClearLeftY, Config::Frame::Effect::PerfectClearAlive,
+        Tile::obj::PerfectClearLeft::Attribute0Base, Tile::obj::PerfectClearLeft::Attribute1Base, Tile::obj::PerfectClearLeft::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::PerfectClear, EffectGroup::PerfectClear,
+      },
+      // PerfectClearRight
+      {
+        Config::Position::Effect::PerfectClearRightX, Config::Position::Effect::PerfectClearRightY, Config::Frame::Effect::PerfectClearAlive,
+        Tile::obj::PerfectClearRight::Attribute0Base, Tile::obj::PerfectClearRight::Attribute1Base, Tile::obj::PerfectClearRight::Attribute2Base | Config::Priority::Object::Effects,
+        EffectGroup::PerfectClear, 0,
+      },
+    }};
+
+    constexpr const EffectInfo& GetEffectInfo(EffectType type) {
+      return EffectInfos[static_cast<std::size_t>(type)];
     }
 
 
-    inline void SetBlockTile(unsigned int x, unsigned int y, std::uint16_t tile) {
-      gba::pointer_memory::VRAM_BGMAP<Config::ScrBase::BG1Game>[(y + Config::Position::GameScreenY) * 32 + (x + Config::Position::GameScreenX)] = tile;
+    template<typename BoardMap>
+    inline void SetBlockTile(BoardMap& boardMap, unsigned int x, unsigned int y, std::uint16_t tile) {
+      boardMap.SetTile(x + Config::Position::GameScreenX, y + Config::Position::GameScreenY, tile);
     }
 
 
@@ -100,58 +211,6 @@ namespace GameTetra {
   }
 
 
-  // ## SimpleEffectObject
-  ////////////////////////////////////////////////////////////////////////////////
-
-
-  SimpleEffectObject::SimpleEffectObject(std::uint_fast16_t objId, unsigned int x, unsigned int y, unsigned int aliveFrame) :
-    mObjId(objId),
-    mX(x),
-    mY(y),
-    mAliveFrame(aliveFrame),
-    mPtrObjAttr(&gba::pointer_memory::OAM[mObjId]),
-    mFrameCount(0)
-  {}
-
-
-  SimpleEffectObject::SimpleEffectObject(std::uint_fast16_t objId, unsigned int x, unsigned int y, unsigned int aliveFrame, std::uint_fast16_t attr0Base, std::uint_fast16_t attr1Base, std::uint_fast16_t attr2Base) :
-    SimpleEffectObject(objId, x, y, aliveFrame)
-  {
-    mPtrObjAttr->attr0 = attr0Base | gba::OBJATTR0::Y(y);
-    mPtrObjAttr->attr1 = attr1Base | gba::OBJATTR1::X(x);
-    mPtrObjAttr->attr2 = attr2Base;
-  }
-
-
-  void SimpleEffectObject::Erase() {
-    //mPtrObjAttr->attr0 = gba::OBJATTR0::OBJ_DISABLE;
-    gba::pointer_memory::OAM[mObjId].attr0 = gba::OBJATTR0::OBJ_DISABLE;
-  }
-
-
-  SimpleEffectObject::~SimpleEffectObject() {
-    Erase();
-  }
-
-
-  bool SimpleEffectObject::Step() {
-    //DbgPrintf("Step: %d, %d / %d\n", mObjId, mFrameCount, mAliveFrame);
-
-    if (!mAliveFrame) {
-      return false;
-    }
-
-    if (mFrameCount == mAliveFrame) {
-      Erase();
-      return true;
-    }
-
-    mFrameCount++;
-
-    return false;
-  }
-
-
   // ## GameScene
   ////////////////////////////////////////////////////////////////////////////////
 
@@ -221,29 +280,33 @@ namespace GameTetra {
     //
     mFallCounter(0),
     //
+    mStateChecksum(Crc32::InitialValue),
+    //
+    mScoreField(Config::Position::ScoreScreenX, Config::Position::ScoreScreenY + 1, 9),
+    mLevelField(Config::Position::ScoreScreenX + 6, Config::Position::ScoreScreenY + 3, 3),
+    mLinesField(Config::Position::ScoreScreenX + 6, Config::Position::ScoreScreenY + 5, 3),
+    //
     mHardDropEffectInfo{},
     //
-    mPerfectClearLeftEffect(),
-    mPerfectClearRightEffect(),
-    mTetrisEffect(),
-    mTSpinEffect(),
-    mTSpinSDTEffect(),
-    mTSpinMiniEffect(),
-    mRenEffect(),
-    mRenDigit1Effect(),
-    mRenDigit21Effect(),
-    mRenDigit22Effect(),
-    mBackToBackEffect(),
+    mBoardMap(),
+    mBoardVisible(true),
+    mPrevRenderedBlocks(nullptr),
+    mPrevHardDropEffectRows(0),
+    mPrevPieceCells{},
+    mNumPrevPieceCells(0),
+    //
+    mEffects(),
     //
-    mBaggedMinoFactory(),
+    mMinoFactory(),
     mGame(Tetra::Game::Game::InitializeInfo{
       Config::Board::WidthIncludingBorder,
       Config::Board::HeightIncludingBorder,
       Config::Board::BaseYIncludingBorder,
       Config::Board::NumNexts,
       [this] (const Tetra::Game::Game& game) {
-        return mBaggedMinoFactory(game);
+        return mMinoFactory(game);
       },
+      gBoardBlockStorage.data(),
     })
   {
     //DbgPrintf("ctor of GameTetra::GameScene\n");
@@ -252,11 +315,12 @@ namespace GameTetra {
 
     ResetNextFallFrame();
 
-#ifndef RELEASE_BUILD
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
     InitializeDebugBoard();
 #endif
 
     InitializeObjects();
+    InitializeScoreBoard();
 
     Root::PlayMusicFromConfig();
   }
@@ -267,23 +331,13 @@ namespace GameTetra {
 
     MusicManager::GetInstance().Stop();
 
-    for (unsigned int i = 0; i < Tetra::MaxMinoSize; i++) {
-      const auto objIdDiff = Config::ObjId::LineClearDiff * i;
-
-      DisableObject(Config::ObjId::LineClearFirstLeft + objIdDiff);
-
-      DisableObject(Config::ObjId::LineClearFirstRight + objIdDiff);
+    auto& shadowOAM = ShadowOAM::GetInstance();
 
-      for (unsigned int j = 0; j < Config::ObjId::NumLineClearMiddle; j++) {
-        DisableObject(Config::ObjId::LineClearFirstMiddleFirst + objIdDiff + j);
-      }
-    }
+    DisableLineClearObjects();
 
-    DisableObject(Config::ObjId::HoldMino);
+    shadowOAM.Disable(Config::ObjId::HoldMino);
 
-    for (unsigned int i = 0; i < Config::Board::NumNexts; i++) {
-      DisableObject(Config::ObjId::NextMinoFirst + i);
-    }
+    shadowOAM.Disable(Config::ObjId::NextMinoFirst, Config::Board::NumNexts);
   }
 
 
@@ -332,7 +386,7 @@ namespace GameTetra {
   }
 
 
-#ifndef RELEASE_BUILD
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
   void GameScene::InitializeDebugBoard() {
     [[maybe_unused]] constexpr auto N = Tetra::BlockType::None;
     [[maybe_unused]] constexpr auto I = Tetra::BlockType::I;
@@ -366,6 +420,8 @@ namespace GameTetra {
 
       boardInfo.blockCount = blockCount;
 
+      mGame.MarkAllRowsDirty();
+
       // update ghost position
       mGame.MoveLeft();
       mGame.MoveRight();
@@ -457,7 +513,7 @@ namespace GameTetra {
 
       // Left
       {
-        volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstLeft + objIdDiff];
+        auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::LineClearFirstLeft + objIdDiff];
         objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
         objAttr.attr1 = Tile::obj::LineClearEffectLeft::Attribute1Base | gba::OBJATTR1::X(Config::Position::LineClearLeftX);
         objAttr.attr2 = Tile::obj::LineClearEffectLeft::Attribute2Base | Config::Priority::Object::LineClearAnime;
@@ -465,7 +521,7 @@ namespace GameTetra {
 
       // Right
       {
-        volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstRight + objIdDiff];
+        auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::LineClearFirstRight + objIdDiff];
         objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
         objAttr.attr1 = Tile::obj::LineClearEffectRight::Attribute1Base | gba::OBJATTR1::X(Config::Position::LineClearRightX);
         objAttr.attr2 = Tile::obj::LineClearEffectRight::Attribute2Base | Config::Priority::Object::LineClearAnime;
@@ -473,7 +529,7 @@ namespace GameTetra {
 
       // Middle
       for (unsigned int j = 0; j < Config::ObjId::NumLineClearMiddle; j++) {
-        volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstMiddleFirst + objIdDiff + j];
+        auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::LineClearFirstMiddleFirst + objIdDiff + j];
         objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
         objAttr.attr1 = Tile::obj::LineClearEffectMiddle::Attribute1Base | gba::OBJATTR1::X(Config::Position::LineClearMiddleStartX + j * Tile::obj::LineClearEffectMiddle::Width * 8);
         objAttr.attr2 = Tile::obj::LineClearEffectMiddle::Attribute2Base | Config::Priority::Object::LineClearAnime;
@@ -482,7 +538,7 @@ namespace GameTetra {
 
     // initialize hold mino attributes
     {
-      volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::HoldMino];
+      auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::HoldMino];
       objAttr.attr0 = Tile::obj::Mino::Attribute0Base | gba::OBJATTR0::Y(Config::Position::HoldY);
       objAttr.attr1 = Tile::obj::Mino::Attribute1Base | gba::OBJATTR1::X(Config::Position::HoldX);
       objAttr.attr2 = gba::OBJATTR2::TILE(Tile::obj::Empty::TileIndex) | Config::Priority::Object::Hold | gba::OBJATTR2::PALETTE(Tile::obj::Mino::Palette);
@@ -490,7 +546,7 @@ namespace GameTetra {
 
     // initialize next mino attributes
     for (unsigned int i = 0; i < Config::Board::NumNexts; i++) {
-      volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::NextMinoFirst + i];
+      auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::NextMinoFirst + i];
       objAttr.attr0 = Tile::obj::Mino::Attribute0Base | gba::OBJATTR0::Y(Config::Position::NextY + Config::Position::NextH * i);
       objAttr.attr1 = Tile::obj::Mino::Attribute1Base | gba::OBJATTR1::X(Config::Position::NextX);
       objAttr.attr2 = gba::OBJATTR2::TILE(Tile::obj::Empty::TileIndex) | Config::Priority::Object::Nexts | gba::OBJATTR2::PALETTE(Tile::obj::Mino::Palette);
@@ -498,6 +554,13 @@ namespace GameTetra {
   }
 
 
+  void GameScene::InitializeScoreBoard() {
+    TilePrint<Config::ScrBase::BG0Score>("SCORE", Config::Position::ScoreScreenX, Config::Position::ScoreScreenY);
+    TilePrint<Config::ScrBase::BG0Score>(mExtreme ? "LEVEL  EX" : "LEVEL ", Config::Position::ScoreScreenX, Config::Position::ScoreScreenY + 3);
+    TilePrint<Config::ScrBase::BG0Score>("LINES ", Config::Position::ScoreScreenX, Config::Position::ScoreScreenY + 5);
+  }
+
+
   // ## GameScene/Utilities
   ////////////////////////////////////////////////////////////////////////////////
 
@@ -523,18 +586,66 @@ namespace GameTetra {
   ////////////////////////////////////////////////////////////////////////////////
 
 
+  void GameScene::FlipBoardMap() {
+    if (!mBoardMap.Flip() || !mBoardVisible) {
+      return;
+    }
+
+    gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(mBoardMap.GetScreenBaseBlock()) | Config::Priority::BG1;
+  }
+
+
   void GameScene::RenderBoardTile() {
+    Profiler::Zone<Profiler::ZoneId::RenderBoardTile> profilerZone;
+
     const auto& boardInfo = mGame.GetBoardInfo();
 
     const auto blocks = mMinoWaitState == MinoWaitState::WaitByLineClear ? mPtrLastLineClearInfo->blocksAfterClear : boardInfo.blocks;
 
+    const auto getBlockTile = [blocks] (int x, int y) {
+      return BlockTypeToMap[static_cast<unsigned int>(blocks[(y + Config::Board::BaseYIncludingBorder) * Config::Board::WidthIncludingBorder + x + Config::Board::Border])];
+    };
+
+    // rows to be re-rendered: rows changed in the game, rows covered by the hard drop effect (previous and current)
+    // and all rows if the board to be rendered is switched
+    auto dirtyRows = static_cast<VisibleRowMask>(mGame.GetDirtyRows() >> Config::Board::BaseYIncludingBorder) | mPrevHardDropEffectRows;
+    mGame.ClearDirtyRows();
+
+    if (blocks != mPrevRenderedBlocks) {
+      dirtyRows = ~VisibleRowMask{0};
+      mPrevRenderedBlocks = blocks;
+    }
+
+    VisibleRowMask hardDropEffectRows = 0;
+    for (unsigned int i = 0; i < mHardDropEffectInfo.numColumns; i++) {
+      for (unsigned int ry = 0; ry < mHardDropEffectInfo.length; ry++) {
+        hardDropEffectRows |= VisibleRowMask{1} << (mHardDropEffectInfo.ys[i] + ry);
+      }
+    }
+    dirtyRows |= hardDropEffectRows;
+    mPrevHardDropEffectRows = hardDropEffectRows;
+
     // render board
     for (unsigned int y = 0; y < Config::Board::VisibleHeight; y++) {
+      if (!(dirtyRows & (VisibleRowMask{1} << y))) {
+        continue;
+      }
       for (unsigned int x = 0; x < Config::Board::Width; x++) {
-        SetBlockTile(x, y, BlockTypeToMap[static_cast<unsigned int>(blocks[(y + Config::Board::BaseYIncludingBorder) * Config::Board::WidthIncludingBorder + x + Config::Board::Border])]);
+        SetBlockTile(mBoardMap, x, y, getBlockTile(x, y));
       }
     }
 
+    // restore the cells under the previous current mino and ghost mino
+    for (std::size_t i = 0; i < mNumPrevPieceCells; i++) {
+      const auto& cell = mPrevPieceCells[i];
+      if (dirtyRows & (VisibleRowMask{1} << cell.y)) {
+        continue;
+      }
+      SetBlockTile(mBoardMap, cell.x, cell.y, getBlockTile(cell.x, cell.y));
+    }
+    const bool pieceCellsRestored = mNumPrevPieceCells != 0;
+    mNumPrevPieceCells = 0;
+
     // render hard drop effects
     if (mHardDropEffectInfo.numColumns) {
       for (unsigned int i = 0; i < mHardDropEffectInfo.numColumns; i++) {
@@ -542,12 +653,17 @@ namespace GameTetra {
           const int x = mHardDropEffectInfo.x + static_cast<int>(i);
           const int y = mHardDropEffectInfo.ys[i] + static_cast<int>(ry);
 
+          // 表示範囲の外（シャドウマップの外）には描かない
+          if (y < 0 || y >= static_cast<int>(Config::Board::VisibleHeight)) {
+            continue;
+          }
+
           if (blocks[(y + Config::Board::BaseYIncludingBorder) * Config::Board::WidthIncludingBorder + x + Config::Board::Border] != Tetra::BlockType::None) {
             continue;
           }
 
           const auto tile = Tile::bg::HardDropEffect::MapData[Tile::bg::HardDropEffect::Height - mHardDropEffectInfo.length + ry];
-          SetBlockTile(x, y, tile);
+          SetBlockTile(mBoardMap, x, y, tile);
         }
       }
     }
@@ -564,7 +680,8 @@ namespace GameTetra {
         if (y < 0) {
           continue;
         }
-        SetBlockTile(x, y, cell.tile);
+        SetBlockTile(mBoardMap, x, y, cell.tile);
+        mPrevPieceCells[mNumPrevPieceCells++] = BoardCell{x, y};
       }
 
       // render current mino
@@ -576,9 +693,15 @@ namespace GameTetra {
         if (y < 0) {
           continue;
         }
-        SetBlockTile(x, y, currentMinoTile);
+        SetBlockTile(mBoardMap, x, y, currentMinoTile);
+        mPrevPieceCells[mNumPrevPieceCells++] = BoardCell{x, y};
       }
     }
+
+    // nothing is transferred on frames without any change (e.g. while waiting for the next mino)
+    if (dirtyRows || pieceCellsRestored || mNumPrevPieceCells) {
+      mBoardMap.Flush();
+    }
   }
 
 
@@ -587,7 +710,7 @@ namespace GameTetra {
       return;
     }
 
-    volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::HoldMino];
+    auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::HoldMino];
 
     const auto& boardInfo = mGame.GetBoardInfo();
 
@@ -617,7 +740,7 @@ namespace GameTetra {
       const auto mino = boardInfo.nextMinos[i];
       const unsigned int minoTileIndex = Tile::obj::Mino::TileIndex + static_cast<unsigned int>(mino) * Tile::obj::Mino::MapWidth * Tile::obj::Mino::MapHeight;
 
-      volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::NextMinoFirst + i];
+      auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::NextMinoFirst + i];
 
       objAttr.attr0 = Tile::obj::Mino::Attribute0Base | gba::OBJATTR0::Y(Config::Position::NextY + Config::Position::NextH * i);
       objAttr.attr1 = Tile::obj::Mino::Attribute1Base | gba::OBJATTR1::X(Config::Position::NextX);
@@ -628,27 +751,7 @@ namespace GameTetra {
 
   void GameScene::RenderLineClearAnime() {
     if (mLineClearAnimeState == 0) {
-      for (unsigned int i = 0; i < Tetra::MaxMinoSize; i++) {
-        const auto objIdDiff = Config::ObjId::LineClearDiff * i;
-
-        // Left
-        {
-          volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstLeft + objIdDiff];
-          objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
-        }
-
-        // Right
-        {
-          volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstRight + objIdDiff];
-          objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
-        }
-
-        // Middle
-        for (unsigned int j = 0; j < Config::ObjId::NumLineClearMiddle; j++) {
-          volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstMiddleFirst + objIdDiff + j];
-          objAttr.attr0 = gba::OBJATTR0::OBJ_DISABLE;
-        }
-      }
+      DisableLineClearObjects();
     } else {
       const auto lines = mPtrLastLineClearInfo->numLines;
       for (unsigned int i = 0; i < lines; i++) {
@@ -660,7 +763,7 @@ namespace GameTetra {
         {
           using namespace Tile::obj::LineClearEffectLeft;
 
-          volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstLeft + objIdDiff];
+          auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::LineClearFirstLeft + objIdDiff];
           objAttr.attr0 = Tile::obj::LineClearEffectLeft::Attribute0Base | gba::OBJATTR0::Y(y);
           objAttr.attr2 = gba::OBJATTR2::TILE(TileIndex + MapWidth * MapHeight * (mLineClearAnimeState - 1)) | Config::Priority::Object::LineClearAnime | gba::OBJATTR2::PALETTE(Palette);
         }
@@ -669,7 +772,7 @@ namespace GameTetra {
         {
           using namespace Tile::obj::LineClearEffectRight;
 
-          volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstRight + objIdDiff];
+          auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::LineClearFirstRight + objIdDiff];
           objAttr.attr0 = Tile::obj::LineClearEffectRight::Attribute0Base | gba::OBJATTR0::Y(y);
           objAttr.attr2 = gba::OBJATTR2::TILE(TileIndex + MapWidth * MapHeight * (mLineClearAnimeState - 1)) | Config::Priority::Object::LineClearAnime | gba::OBJATTR2::PALETTE(Palette);
         }
@@ -678,7 +781,7 @@ namespace GameTetra {
         for (unsigned int j = 0; j < Config::ObjId::NumLineClearMiddle; j++) {
           using namespace Tile::obj::LineClearEffectMiddle;
 
-          volatile auto& objAttr = gba::pointer_memory::OAM[Config::ObjId::LineClearFirstMiddleFirst + objIdDiff + j];
+          auto& objAttr = ShadowOAM::GetInstance()[Config::ObjId::LineClearFirstMiddleFirst + objIdDiff + j];
           objAttr.attr0 = Tile::obj::LineClearEffectMiddle::Attribute0Base | gba::OBJATTR0::Y(y);
           objAttr.attr2 = gba::OBJATTR2::TILE(TileIndex + MapWidth * MapHeight * (mLineClearAnimeState - 1)) | Config::Priority::Object::LineClearAnime | gba::OBJATTR2::PALETTE(Palette);
         }
@@ -688,47 +791,26 @@ namespace GameTetra {
 
 
   void GameScene::RenderEffects() {
-    constexpr auto stepEffect = [] (auto& effect) {
-      if (!effect) {
-        return;
-      }
-      effect.value().Step();
-    };
-
-    stepEffect(mPerfectClearLeftEffect);
-    stepEffect(mPerfectClearRightEffect);
-    stepEffect(mTetrisEffect);
-    stepEffect(mTSpinEffect);
-    stepEffect(mTSpinSDTEffect);
-    stepEffect(mTSpinMiniEffect);
-    stepEffect(mRenEffect);
-    stepEffect(mRenDigit1Effect);
-    stepEffect(mRenDigit21Effect);
-    stepEffect(mRenDigit22Effect);
-    stepEffect(mBackToBackEffect);
+    mEffects.Step();
   }
 
 
   void GameScene::Render() {
     //DbgPrintf("render %d (%d)\n", mFrameCount, gba::reg::VCOUNT);
 
-    static char str[32];
+    // Render() は VBlankIntrWait() の直後に呼ばれるので、前のフレームで裏に描いた盤面をここで表示する
+    // （画面の途中で切り替えると盤面が上下で混ざる、処理落ちしても次の VBlank まで待ってから来るのでここは VBlank 中）
+    FlipBoardMap();
 
-    snprintf(str, sizeof(str), "SCORE\n%9d", mScore);
-    //snprintf(str, sizeof(str), "SCORE\n%09d", mScore);
-    TilePrint<Config::ScrBase::BG0Score>(str, Config::Position::ScoreScreenX, Config::Position::ScoreScreenY);
+    RenderBoardTile();
 
-    if (mExtreme) {
-      snprintf(str, sizeof(str), "LEVEL  EX");
-    } else{
-      snprintf(str, sizeof(str), "LEVEL %3d", mLevel);
+    // 見出しと EX は InitializeScoreBoard() で描いてある
+    mScoreField.Print(mScore);
+    if (!mExtreme) {
+      mLevelField.Print(mLevel);
     }
-    TilePrint<Config::ScrBase::BG0Score>(str, Config::Position::ScoreScreenX, Config::Position::ScoreScreenY + 3);
+    mLinesField.Print(mGame.GetGameStatistics().numClearedLines);
 
-    snprintf(str, sizeof(str), "LINES %3d", mGame.GetGameStatistics().numClearedLines);
-    TilePrint<Config::ScrBase::BG0Score>(str, Config::Position::ScoreScreenX, Config::Position::ScoreScreenY + 5);
-
-    RenderBoardTile();
     RenderHoldMino();
     RenderNextMinos();
     RenderLineClearAnime();
@@ -890,11 +972,11 @@ namespace GameTetra {
 
       //DbgPrintf("T-Spin %d\n", static_cast<unsigned int>(mTSpin));
 
-      // erase Tetris effect because it puts on
-      mTetrisEffect.reset();
+      // Tetris と前の T-Spin は消える
+      mEffects.Show(GetEffectInfo(EffectType::TSpin));
 
       if (IsMiniArray[static_cast<unsigned int>(mTSpin)]) {
-        mTSpinMiniEffect.emplace(Config::ObjId::TSpin::Mini, Config::Position::Effect::MiniX, Config::Position::Effect::MiniY, Config::Frame::Effect::TSpinAlive, Tile::obj::Mini::Attribute0Base, Tile::obj::Mini::Attribute1Base, Tile::obj::Mini::Attribute2Base | Config::Priority::Object::Effects);
+        mEffects.Show(GetEffectInfo(EffectType::TSpinMini));
       }
 
       if (const auto type = SDTArray[static_cast<unsigned int>(mTSpin)]; type) {
@@ -905,28 +987,19 @@ namespace GameTetra {
           Tile::obj::Triple::Attribute2Base | Config::Priority::Object::Effects,
         };
 
-        mTSpinSDTEffect.emplace(Config::ObjId::TSpin::SDT, Config::Position::Effect::TSpinSDTX, Config::Position::Effect::TSpinSDTY, Config::Frame::Effect::TSpinAlive, Tile::obj::Single::Attribute0Base, Tile::obj::Single::Attribute1Base, Attribute2Array[type]);
+        mEffects.Show(GetEffectInfo(EffectType::TSpinSDT), Attribute2Array[type]);
       }
-
-      mTSpinEffect.emplace(Config::ObjId::TSpin::TSpin, Config::Position::Effect::TSpinX, Config::Position::Effect::TSpinY, Config::Frame::Effect::TSpinAlive, Tile::obj::TSpin::Attribute0Base, Tile::obj::TSpin::Attribute1Base, Tile::obj::TSpin::Attribute2Base | Config::Priority::Object::Effects);
     }
 
     // tetris effect
     if (mLineCleared && mPtrLastLineClearInfo->numLines == 4) {
-      // erase T-Spin effects because they put on
-      mTSpinEffect.reset();
-      mTSpinMiniEffect.reset();
-      mTSpinSDTEffect.reset();
-
-      mTetrisEffect.emplace(Config::ObjId::Tetris, Config::Position::Effect::TetrisX, Config::Position::Effect::TetrisY, Config::Frame::Effect::TetrisAlive, Tile::obj::Tetris::Attribute0Base, Tile::obj::Tetris::Attribute1Base, Tile::obj::Tetris::Attribute2Base | Config::Priority::Object::Effects);
+      // T-Spin は消える
+      mEffects.Show(GetEffectInfo(EffectType::Tetris));
     }
 
     // REN effect
     if (mMinoLocked) {
-      mRenEffect.reset();
-      mRenDigit1Effect.reset();
-      mRenDigit21Effect.reset();
-      mRenDigit22Effect.reset();
+      mEffects.Hide(EffectGroup::Ren);
     }
 
     if (mLineCleared) {
@@ -940,26 +1013,26 @@ namespace GameTetra {
           return array;
         })();
 
-        mRenEffect.emplace(Config::ObjId::Ren::Ren, Config::Position::Effect::RenX, Config::Position::Effect::RenY, Config::Frame::Effect::RenAlive, Tile::obj::Ren::Attribute0Base, Tile::obj::Ren::Attribute1Base, Tile::obj::Ren::Attribute2Base | Config::Priority::Object::Effects);
+        mEffects.Show(GetEffectInfo(EffectType::Ren));
 
         if (mPtrLastLineClearInfo->ren < 10) {
-          mRenDigit1Effect.emplace(Config::ObjId::Ren::Digit1, Config::Position::Effect::RenDigit1X, Config::Position::Effect::RenDigitY, Config::Frame::Effect::RenAlive, Tile::obj::Number::Attribute0Base, Tile::obj::Number::Attribute1Base, DigitAttribute2Array[ren]);
+          mEffects.Show(GetEffectInfo(EffectType::RenDigit1), DigitAttribute2Array[ren]);
         } else {
-          mRenDigit21Effect.emplace(Config::ObjId::Ren::Digit21, Config::Position::Effect::RenDigit21X, Config::Position::Effect::RenDigitY, Config::Frame::Effect::RenAlive, Tile::obj::Number::Attribute0Base, Tile::obj::Number::Attribute1Base, DigitAttribute2Array[ren / 10]);
-          mRenDigit22Effect.emplace(Config::ObjId::Ren::Digit22, Config::Position::Effect::RenDigit22X, Config::Position::Effect::RenDigitY, Config::Frame::Effect::RenAlive, Tile::obj::Number::Attribute0Base, Tile::obj::Number::Attribute1Base, DigitAttribute2Array[ren % 10]);
+          mEffects.Show(GetEffectInfo(EffectType::RenDigit21), DigitAttribute2Array[ren / 10]);
+          mEffects.Show(GetEffectInfo(EffectType::RenDigit22), DigitAttribute2Array[ren % 10]);
         }
       }
     }
 
     // back to back effect
     if ((mLineCleared || mTSpin != Tetra::TSpin::None) && mBackToBackCount) {
-      mBackToBackEffect.emplace(Config::ObjId::BackToBack, Config::Position::Effect::BackToBackX, Config::Position::Effect::BackToBackY, Config::Frame::Effect::BackToBackAlive, Tile::obj::BackToBack::Attribute0Base, Tile::obj::BackToBack::Attribute1Base, Tile::obj::BackToBack::Attribute2Base | Config::Priority::Object::Effects);
+      mEffects.Show(GetEffectInfo(EffectType::BackToBack));
     }
 
     // perfect clear effect
     if (mLineCleared && mPtrLastLineClearInfo->perfectClear) {
-      mPerfectClearLeftEffect.emplace(Config::ObjId::PerfectClearLeft, Config::Position::Effect::PerfectClearLeftX, Config::Position::Effect::PerfectClearLeftY, Config::Frame::Effect::PerfectClearAlive, Tile::obj::PerfectClearLeft::Attribute0Base, Tile::obj::PerfectClearLeft::Attribute1Base, Tile::obj::PerfectClearLeft::Attribute2Base | Config::Priority::Object::Effects);
-      mPerfectClearRightEffect.emplace(Config::ObjId::PerfectClearRight, Config::Position::Effect::PerfectClearRightX, Config::Position::Effect::PerfectClearRightY, Config::Frame::Effect::PerfectClearAlive, Tile::obj::PerfectClearRight::Attribute0Base, Tile::obj::PerfectClearRight::Attribute1Base, Tile::obj::PerfectClearRight::Attribute2Base | Config::Priority::Object::Effects);
+      mEffects.Show(GetEffectInfo(EffectType::PerfectClearLeft));
+      mEffects.Show(GetEffectInfo(EffectType::PerfectClearRight));
     }
   }
 
@@ -1041,14 +1114,16 @@ namespace GameTetra {
 
 
   void GameScene::UpdateGame() {
+    Profiler::Zone<Profiler::ZoneId::UpdateGame> profilerZone;
+
     if (mMinoWaitState != MinoWaitState::None) {
       return;
     }
 
 
-    const auto prevMino = mGame.GetBoardInfo().currentMino;
-    const auto prevPosition = mGame.GetBoardInfo().currentPosition;
-    const auto prevRotation = mGame.GetBoardInfo().currentRotation;
+    auto prevMino = mGame.GetBoardInfo().currentMino;
+    auto prevPosition = mGame.GetBoardInfo().currentPosition;
+    auto prevRotation = mGame.GetBoardInfo().currentRotation;
 
     int hardDropDistance = 0;
     UserOperation userOperation = UserOperation::None;
@@ -1112,7 +1187,11 @@ namespace GameTetra {
       }
       if (mKeyInputUp->GetState() && mFrameCount - mLastMinoShowFrame >= Config::Frame::Key::HardDropEnableWait) {
         userOperation = UserOperation::HardDrop;
-        const auto prevY = mGame.GetBoardInfo().currentPosition.y;
+        // auto fall, move and rotation in this frame may have already changed the mino, so take it again here
+        prevMino = mGame.GetBoardInfo().currentMino;
+        prevPosition = mGame.GetBoardInfo().currentPosition;
+        prevRotation = mGame.GetBoardInfo().currentRotation;
+        const auto prevY = prevPosition.y;
         // NOTE: DropBottom returns `true` normally
         userOperationSucceeded = mGame.DropBottom(false);
         hardDropDistance = mGame.GetBoardInfo().currentPosition.y - prevY;
@@ -1213,6 +1292,30 @@ namespace GameTetra {
   }
 
 
+  // 1フレームに1回、前フレームまでの値に今フレームの状態を連結してCRCを取る
+  // 乱数の状態は含めない（乱数がずれればNEXTに現れるため）
+  void GameScene::UpdateStateChecksum() {
+    const auto& boardInfo = mGame.GetBoardInfo();
+
+    auto crc = mStateChecksum;
+    crc = Crc32::UpdateValue(crc, mFrameCount);
+    crc = Crc32::Update(crc, boardInfo.blocks, boardInfo.boardWidth * boardInfo.boardHeight * sizeof(Tetra::BlockType));
+    crc = Crc32::UpdateValue(crc, boardInfo.currentMino);
+    crc = Crc32::UpdateValue(crc, boardInfo.currentPosition.x);
+    crc = Crc32::UpdateValue(crc, boardInfo.currentPosition.y);
+    crc = Crc32::UpdateValue(crc, boardInfo.currentRotation);
+    crc = Crc32::UpdateValue(crc, boardInfo.holdMino ? static_cast<int>(*boardInfo.holdMino) : -1);
+    crc = Crc32::UpdateValue(crc, boardInfo.holdUsed);
+    for (const auto minoType : boardInfo.nextMinos) {
+      crc = Crc32::UpdateValue(crc, minoType);
+    }
+    crc = Crc32::UpdateValue(crc, mScore);
+    crc = Crc32::UpdateValue(crc, mLevel);
+    crc = Crc32::UpdateValue(crc, mMinoWaitState);
+    mStateChecksum = crc;
+  }
+
+
   void GameScene::Update() {
     //DbgPrintf("update %d : %d, %d\n", mFrameCount, static_cast<int>(mMinoWaitState), mNextMinoShowFrame);
 
@@ -1230,6 +1333,9 @@ namespace GameTetra {
     UpdateMinoWaitState();
     UpdateGame();
 
+    // ゲームクリアとゲームオーバーが決まるフレームも含める
+    UpdateStateChecksum();
+
     if (mPrevMinoWaitState != MinoWaitState::None && mMinoWaitState == MinoWaitState::None && mGame.GetGameStatistics().numClearedLines >= mLinesToGameClear) {
       mMinoWaitState = MinoWaitState::GameEnd;
       SetScene(SceneId::GameClear);
@@ -1268,4 +1374,18 @@ namespace GameTetra {
   std::uint_fast32_t GameScene::GetScore() const {
     return mScore;
   }
+
+
+  Crc32::Value GameScene::GetStateChecksum() const {
+    return mStateChecksum;
+  }
+
+
+  void GameScene::SetBoardVisible(bool visible) {
+    mBoardVisible = visible;
+
+    if (visible) {
+      gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(mBoardMap.GetScreenBaseBlock()) | Config::Priority::BG1;
+    }
+  }
 }   // namespace GameTetra
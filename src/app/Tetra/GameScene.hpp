@@ -1,47 +1,45 @@
 #pragma once
 
 #include "Scene.hpp"
-#include "BaggedMinoFactory.hpp"
+#include "Config.hpp"
+#include "EffectPool.hpp"
+#include "RandomizedMinoFactory.hpp"
 #include "Tetra/Game.hpp"
+#include "../Crc32.hpp"
+#include "../DoubleBufferedBGMap.hpp"
 #include "../GameConfig.hpp"
+#include "../TilePrint.hpp"
 #include "../Signal/SignalBase.hpp"
 
 #include <array>
 #include <cassert>
 #include <memory>
-#include <optional>
 #include <gba.hpp>
 
 
 namespace GameTetra {
-  class SimpleEffectObject {
-  protected:
-    std::uint_fast16_t mObjId;
-    unsigned int mX;
-    unsigned int mY;
-    unsigned int mAliveFrame;
-    volatile gba::OBJAttr* mPtrObjAttr;
-    unsigned int mFrameCount;
+  class GameScene : public Scene {
+    // frame count, must be unsigned
+    using Frame = unsigned int;
 
-    SimpleEffectObject(std::uint_fast16_t objId, unsigned int x, unsigned int y, unsigned int aliveFrame);
+    // ランダマイザはここで切り替える（Randomizer::Bag7 / Bag14 / TGMHistory / Memoryless）
+    using MinoFactory = RandomizedMinoFactory<Randomizer::Bag7>;
 
-    void Erase();
+    // 盤面（BG1）の表示範囲
+    // RenderBoardTile() で裏のスクリーンブロックに転送し、次のフレームの Render() の最初（VBlank 中）に BG1CNT を切り替えて表示する
+    using BoardMap = DoubleBufferedBGMap<Config::ScrBase::BG1Game, Config::ScrBase::BG1GameBack, Config::Position::GameScreenY, Config::Board::VisibleHeight>;
 
-  public:
-    // to suppress GCC warnings
-    SimpleEffectObject(const SimpleEffectObject&) = default;
-    SimpleEffectObject& operator=(const SimpleEffectObject&) = default;
+    // 表示範囲の行ごとのフラグ（bit y = 表示範囲の y 行目）
+    using VisibleRowMask = std::uint32_t;
+    static_assert(Config::Board::VisibleHeight <= sizeof(VisibleRowMask) * 8);
 
-    SimpleEffectObject(std::uint_fast16_t objId, unsigned int x, unsigned int y, unsigned int aliveFrame, std::uint_fast16_t attr0Base, std::uint_fast16_t attr1Base, std::uint_fast16_t attr2Base);
-    virtual ~SimpleEffectObject();
+    // 現在のミノとゴーストが占めるセルの最大数
+    static constexpr std::size_t MaxPieceCells = Tetra::NumMinoCells * 2;
 
-    virtual bool Step();
-  };
-
-
-  class GameScene : public Scene {
-    // frame count, must be unsigned
-    using Frame = unsigned int;
+    struct BoardCell {
+      int x;
+      int y;
+    };
 
     enum class MinoWaitState {
       None,
@@ -122,33 +120,38 @@ namespace GameTetra {
 
     unsigned int mFallCounter;            // 落下フレーム計算用カウンタ（落下間隔が分数なためmFrameCountを用いれない）
 
+    Crc32::Value mStateChecksum;          // ゲーム状態のローリングチェックサム（リプレイの同期ずれ検出用）
+
+    TileNumberField<Config::ScrBase::BG0Score> mScoreField;
+    TileNumberField<Config::ScrBase::BG0Score> mLevelField;
+    TileNumberField<Config::ScrBase::BG0Score> mLinesField;
+
     HardDropEffectInfo mHardDropEffectInfo;
 
-    std::optional<SimpleEffectObject> mPerfectClearLeftEffect;
-    std::optional<SimpleEffectObject> mPerfectClearRightEffect;
-    std::optional<SimpleEffectObject> mTetrisEffect;
-    std::optional<SimpleEffectObject> mTSpinEffect;
-    std::optional<SimpleEffectObject> mTSpinSDTEffect;
-    std::optional<SimpleEffectObject> mTSpinMiniEffect;
-    std::optional<SimpleEffectObject> mRenEffect;
-    std::optional<SimpleEffectObject> mRenDigit1Effect;
-    std::optional<SimpleEffectObject> mRenDigit21Effect;
-    std::optional<SimpleEffectObject> mRenDigit22Effect;
-    std::optional<SimpleEffectObject> mBackToBackEffect;
-
-    BaggedMinoFactory mBaggedMinoFactory;
+    BoardMap mBoardMap;                   // 盤面のBGマップ、RenderBoardTile() で描画してまとめて転送する
+    bool mBoardVisible;                   // BG1 に盤面を表示しているか（GameReadyScene, GamePauseScene が BG1 を使っている間は false）
+    const Tetra::BlockType* mPrevRenderedBlocks;                // 前回描画した盤面（ライン消去中は消去直後の盤面を描くため切り替わる）
+    VisibleRowMask mPrevHardDropEffectRows;                     // 前回ハードドロップエフェクトを描いた行
+    std::array<BoardCell, MaxPieceCells> mPrevPieceCells;       // 前回ミノとゴーストを描いたセル（表示範囲の座標）
+    std::size_t mNumPrevPieceCells;
+
+    EffectPool<Config::ObjId::EffectFirst, Config::ObjId::NumEffects> mEffects;    // T-Spin、REN などの文字
+
+    MinoFactory mMinoFactory;
     Tetra::Game::Game mGame;
 
     void InitializeEventListeners();
-#ifndef RELEASE_BUILD
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
     void InitializeDebugBoard();
 #endif
     void InitializeObjects();
+    void InitializeScoreBoard();
 
     void ResetNextFallFrame();
     void ResetNextLockFrame();
     void AddScore(unsigned int score);
 
+    void FlipBoardMap();
     void RenderBoardTile();
     void RenderHoldMino();
     void RenderNextMinos();
@@ -162,6 +165,7 @@ namespace GameTetra {
     void UpdateSignals();
     void UpdateAnimeAndEffects();
     void UpdateMinoWaitState();
+    void UpdateStateChecksum();
 
   public:
     // to suppress GCC warnings
@@ -175,6 +179,10 @@ namespace GameTetra {
     bool GetExtremeMode() const;
     unsigned int GetLevel() const;
     std::uint_fast32_t GetScore() const;
+    Crc32::Value GetStateChecksum() const;
+
+    // BG1 を盤面の表示に戻す／他のシーンに明け渡す
+    void SetBoardVisible(bool visible);
 
     void Render();
     void Update();
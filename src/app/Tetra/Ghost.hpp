@@ -16,9 +16,9 @@ namespace GameTetra::Ghost {
   constexpr std::uint16_t HasDown         = 1 << 3;
 
   struct CellTile {
-    int x;
-    int y;
-    std::uint_fast16_t tile;
+    std::int8_t x;
+    std::int8_t y;
+    std::uint16_t tile;
   };
   using CellTiles = std::array<CellTile, Tetra::NumMinoCells>;
   using RotatedMinoTile = std::array<CellTiles, Tetra::NumRotationPatterns>;
@@ -68,7 +68,7 @@ namespace GameTetra::Ghost {
           cellTiles[i] = CellTile{
             x,
             y,
-            static_cast<std::uint_fast16_t>(gba::BGMAP::TEXT::TILE(tileIndex) | gba::BGMAP::TEXT::PALETTE(minoIndex + 1)),
+            static_cast<std::uint16_t>(gba::BGMAP::TEXT::TILE(tileIndex) | gba::BGMAP::TEXT::PALETTE(minoIndex + 1)),
           };
         }
 
@@ -0,0 +1,36 @@
+#include "RandomizedMinoFactory.hpp"
+#include "Config.hpp"
+
+
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
+namespace RandomizedMinoFactoryInternal {
+  std::deque<Tetra::MinoType> CreateDebugMinos() {
+    using namespace GameTetra;
+
+    [[maybe_unused]] constexpr auto I = Tetra::MinoType::I;
+    [[maybe_unused]] constexpr auto O = Tetra::MinoType::O;
+    [[maybe_unused]] constexpr auto S = Tetra::MinoType::S;
+    [[maybe_unused]] constexpr auto Z = Tetra::MinoType::Z;
+    [[maybe_unused]] constexpr auto J = Tetra::MinoType::J;
+    [[maybe_unused]] constexpr auto L = Tetra::MinoType::L;
+    [[maybe_unused]] constexpr auto T = Tetra::MinoType::T;
+
+    switch (Config::Debug::DebugBoard) {
+      case Config::Debug::DebugBoardType::DoubleQuad:
+        return std::deque<Tetra::MinoType>{I, I};
+
+      case Config::Debug::DebugBoardType::QuadTST:
+        return std::deque<Tetra::MinoType>{I, T, T};
+
+      case Config::Debug::DebugBoardType::DTPC:
+        return std::deque<Tetra::MinoType>{T, T, T, T, T};
+
+      case Config::Debug::DebugBoardType::REN:
+        return std::deque<Tetra::MinoType>{L, J, L, J, L, J, L, J, L, J, L, J, L, J, L, J, L, J, L, J};
+
+      default:
+        return std::deque<Tetra::MinoType>{};
+    }
+  }
+}   // namespace RandomizedMinoFactoryInternal
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+
+#include "Randomizer.hpp"
+#include "Tetra/Game.hpp"
+#include "../DbgPrintf.hpp"
+
+#include <gba.hpp>
+
+
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
+namespace RandomizedMinoFactoryInternal {
+  std::deque<Tetra::MinoType> CreateDebugMinos();
+}   // namespace RandomizedMinoFactoryInternal
+#endif
+
+
+// Policy は Randomizer.hpp のランダマイザ（Randomizer::Bag7 など）
+template<typename Policy>
+class RandomizedMinoFactory {
+public:
+  using State = typename Policy::State;
+
+private:
+  Policy mPolicy;
+
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
+  std::deque<Tetra::MinoType> mDebugMinos;
+#endif
+
+public:
+  RandomizedMinoFactory() :
+    RandomizedMinoFactory(gba::reg::TM2CNT_L, gba::reg::TM3CNT_L ^ gba::reg::VCOUNT)
+  {}
+
+  // ログに出した種を渡せば同じ順でミノが出る
+  RandomizedMinoFactory(Randomizer::result_type seedW, Randomizer::result_type seedX) :
+    mPolicy(seedW, seedX)
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
+    ,mDebugMinos(RandomizedMinoFactoryInternal::CreateDebugMinos())
+#endif
+  {
+    // result_type（std::uint_fast32_t）はホストでは64bitなので、%x に合わせて unsigned int にする
+    DbgPrintf("RandomizedMinoFactory: seedW = %08x, seedX = %08x\n", static_cast<unsigned int>(seedW), static_cast<unsigned int>(seedX));
+  }
+
+  Tetra::MinoType operator()([[maybe_unused]] const Tetra::Game::Game& game) {
+#if !defined(RELEASE_BUILD) || defined(DEBUG_BOARD)
+    if (!mDebugMinos.empty()) {
+      const auto ret = mDebugMinos[0];
+      mDebugMinos.pop_front();
+      return ret;
+    }
+#endif
+
+    return mPolicy.Next();
+  }
+
+  // デバッグ用ミノは考慮しない
+  void Generate(Tetra::MinoType* buffer, std::size_t count) {
+    mPolicy.Generate(buffer, count);
+  }
+
+  const State& GetState() const {
+    return mPolicy.GetState();
+  }
+
+  void SetState(const State& state) {
+    mPolicy.SetState(state);
+  }
+};
+
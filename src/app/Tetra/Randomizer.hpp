@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Tetra/Common.hpp"
+
+
+// ミノの出現順を決めるランダマイザ群
+// 仮想関数は使わず、RandomizedMinoFactory<Policy> のテンプレート引数でコンパイル時に切り替える
+//
+// 各ポリシーが満たすべきインターフェース:
+//   struct State;                                          トリビアルコピー可能な内部状態（乱数状態込み）
+//   Policy(result_type seedW, result_type seedX);
+//   Tetra::MinoType Next();                                次のミノ
+//   void Generate(Tetra::MinoType* buffer, std::size_t count);   count個まとめて生成
+//   const State& GetState() const;                         O(1) スナップショット
+//   void SetState(const State& state);                     O(1) 復元
+namespace Randomizer {
+  using result_type = std::uint_fast32_t;
+
+  // xorshift128 の内部状態、スナップショット用にそのままコピーできる
+  struct RandomState {
+    result_type w;
+    result_type x;
+    result_type y;
+    result_type z;
+  };
+
+
+  namespace InternalImpl {
+    constexpr result_type DefaultY = 362436069;
+    constexpr result_type DefaultZ = 521288629;
+
+    // 乱数の種がタイマー由来で偏っているため、最初の方の値を捨てる回数
+    constexpr unsigned int WarmUpCount = 224;
+
+    constexpr result_type NextRandom(RandomState& state) {
+      const result_type t = (state.x ^ (state.x << 11)) & 0xFFFFFFFF;
+      state.x = state.y;
+      state.y = state.z;
+      state.z = state.w;
+      return state.w = (state.w ^ (state.w >> 19)) ^ (t ^ (t >> 8));
+    }
+
+    constexpr RandomState CreateRandomState(result_type seedW, result_type seedX) {
+      RandomState state{
+        seedW,
+        seedX,
+        DefaultY,
+        DefaultZ,
+      };
+      for (unsigned int i = 0; i < WarmUpCount; i++) {
+        NextRandom(state);
+      }
+      return state;
+    }
+
+    // [0, n) の一様乱数
+    // 除算命令がないので剰余ではなく乗算とシフトで求める
+    constexpr std::size_t UniformBelow(RandomState& state, std::size_t n) {
+      return static_cast<std::size_t>((static_cast<std::uint64_t>(NextRandom(state) & 0xFFFFFFFF) * n) >> 32);
+    }
+
+    constexpr Tetra::MinoType RandomMino(RandomState& state) {
+      return static_cast<Tetra::MinoType>(UniformBelow(state, Tetra::NumMinoTypes));
+    }
+  }   // namespace InternalImpl
+
+
+  // NumSets 組の7種ミノを袋に入れてシャッフルする（1 = 7-bag, 2 = 14-bag）
+  template<std::size_t NumSets>
+  class Bag {
+    static_assert(NumSets >= 1);
+
+  public:
+    static constexpr std::size_t BagSize = Tetra::NumMinoTypes * NumSets;
+
+    struct State {
+      RandomState random;
+      std::array<Tetra::MinoType, BagSize> bag;
+      std::size_t index;
+    };
+
+  private:
+    State mState;
+
+    void Shuffle() {
+      mState.index = 0;
+
+      // shuffle (Algorithm P)
+      for (std::size_t i = BagSize - 1; i >= 1; i--) {
+        const std::size_t j = InternalImpl::UniformBelow(mState.random, i + 1);
+        std::swap(mState.bag[i], mState.bag[j]);
+      }
+    }
+
+  public:
+    Bag(result_type seedW, result_type seedX) :
+      mState{
+        InternalImpl::CreateRandomState(seedW, seedX),
+        {},
+        BagSize,
+      }
+    {
+      for (std::size_t i = 0; i < BagSize; i++) {
+        mState.bag[i] = static_cast<Tetra::MinoType>(i % Tetra::NumMinoTypes);
+      }
+    }
+
+    Tetra::MinoType Next() {
+      if (mState.index == BagSize) {
+        Shuffle();
+      }
+      return mState.bag[mState.index++];
+    }
+
+    void Generate(Tetra::MinoType* buffer, std::size_t count) {
+      while (count) {
+        if (mState.index == BagSize) {
+          Shuffle();
+        }
+        const std::size_t n = std::min(count, BagSize - mState.index);
+        std::copy_n(mState.bag.begin() + mState.index, n, buffer);
+        mState.index += n;
+        buffer += n;
+        count -= n;
+      }
+    }
+
+    const State& GetState() const {
+      return mState;
+    }
+
+    void SetState(const State& state) {
+      mState = state;
+    }
+  };
+
+  using Bag7 = Bag<1>;
+  using Bag14 = Bag<2>;
+
+
+  // TGM方式: 直近 HistorySize 個の履歴にあるミノが出たら最大 NumRolls 回まで引き直す
+  // 初手は S, Z, O 以外、履歴の初期値は Z, Z, S, S（TGM2準拠）
+  template<std::size_t HistorySize, unsigned int NumRolls>
+  class History {
+    static_assert(HistorySize >= 1);
+    static_assert(NumRolls >= 1);
+
+  public:
+    struct State {
+      RandomState random;
+      std::array<Tetra::MinoType, HistorySize> history;
+      std::size_t historyIndex;     // 次に上書きする履歴の位置（リングバッファ）
+      bool first;
+    };
+
+  private:
+    State mState;
+
+    bool InHistory(Tetra::MinoType minoType) const {
+      return std::find(mState.history.begin(), mState.history.end(), minoType) != mState.history.end();
+    }
+
+    Tetra::MinoType Roll() {
+      if (mState.first) {
+        mState.first = false;
+
+        constexpr std::array<Tetra::MinoType, 4> FirstMinos{
+          Tetra::MinoType::I,
+          Tetra::MinoType::J,
+          Tetra::MinoType::L,
+          Tetra::MinoType::T,
+        };
+        return FirstMinos[InternalImpl::UniformBelow(mState.random, FirstMinos.size())];
+      }
+
+      Tetra::MinoType minoType = InternalImpl::RandomMino(mState.random);
+      for (unsigned int i = 1; i < NumRolls && InHistory(minoType); i++) {
+        minoType = InternalImpl::RandomMino(mState.random);
+      }
+      return minoType;
+    }
+
+  public:
+    History(result_type seedW, result_type seedX) :
+      mState{
+        InternalImpl::CreateRandomState(seedW, seedX),
+        {},
+        0,
+        true,
+      }
+    {
+      constexpr std::array<Tetra::MinoType, 4> InitialHistory{
+        Tetra::MinoType::Z,
+        Tetra::MinoType::Z,
+        Tetra::MinoType::S,
+        Tetra::MinoType::S,
+      };
+      for (std::size_t i = 0; i < HistorySize; i++) {
+        mState.history[i] = InitialHistory[i % InitialHistory.size()];
+      }
+    }
+
+    Tetra::MinoType Next() {
+      const auto minoType = Roll();
+      mState.history[mState.historyIndex] = minoType;
+      mState.historyIndex = mState.historyIndex + 1 == HistorySize ? 0 : mState.historyIndex + 1;
+      return minoType;
+    }
+
+    void Generate(Tetra::MinoType* buffer, std::size_t count) {
+      for (std::size_t i = 0; i < count; i++) {
+        buffer[i] = Next();
+      }
+    }
+
+    const State& GetState() const {
+      return mState;
+    }
+
+    void SetState(const State& state) {
+      mState = state;
+    }
+  };
+
+  using TGMHistory = History<4, 6>;
+
+
+  // 履歴を持たない完全ランダム
+  class Memoryless {
+  public:
+    struct State {
+      RandomState random;
+    };
+
+  private:
+    State mState;
+
+  public:
+    Memoryless(result_type seedW, result_type seedX) :
+      mState{
+        InternalImpl::CreateRandomState(seedW, seedX),
+      }
+    {}
+
+    Tetra::MinoType Next() {
+      return InternalImpl::RandomMino(mState.random);
+    }
+
+    void Generate(Tetra::MinoType* buffer, std::size_t count) {
+      for (std::size_t i = 0; i < count; i++) {
+        buffer[i] = Next();
+      }
+    }
+
+    const State& GetState() const {
+      return mState;
+    }
+
+    void SetState(const State& state) {
+      mState = state;
+    }
+  };
+
+
+  static_assert(std::is_trivially_copyable_v<Bag7::State>);
+  static_assert(std::is_trivially_copyable_v<Bag14::State>);
+  static_assert(std::is_trivially_copyable_v<TGMHistory::State>);
+  static_assert(std::is_trivially_copyable_v<Memoryless::State>);
+}   // namespace Randomizer
@@ -0,0 +1,12 @@
+#pragma once
+
+
+namespace GameTetra {
+  enum class SceneId {
+    Game,
+    GameClear,
+    GameOver,
+    GamePause,
+    GameReady,
+  };
+}   // namespace GameTetra
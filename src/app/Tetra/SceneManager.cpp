@@ -8,6 +8,8 @@
 #include "GameReadyScene.hpp"
 #include "../CopyVRAM.hpp"
 #include "../DbgPrintf.hpp"
+#include "../FrameCounter.hpp"
+#include "../VRAMUploadQueue.hpp"
 #include "../Sound/MusicManager.hpp"
 #include "../Sound/SoundManager.hpp"
 #include <image/bg.hpp>
@@ -17,31 +19,36 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
-#include <memory>
+#include <type_traits>
+#include <variant>
 
 #include <gba.hpp>
 
 
 namespace GameTetra {
-  std::unique_ptr<Scene> SceneManager::CreateOverrideSceneFromSceneId(SceneId sceneId) {
+  void SceneManager::EmplaceOverrideSceneFromSceneId(SceneId sceneId) {
     switch (sceneId) {
       case SceneId::Game:
-        return nullptr;
+        mOverrideScene.emplace<std::monostate>();
+        return;
 
       case SceneId::GameClear:
-        return std::make_unique<GameClearScene>(*this);
+        mOverrideScene.emplace<GameClearScene>(*this);
+        return;
 
       case SceneId::GameOver:
-        return std::make_unique<GameOverScene>(*this);
+        mOverrideScene.emplace<GameOverScene>(*this);
+        return;
 
       case SceneId::GamePause:
-        return std::make_unique<GamePauseScene>(*this);
+        mOverrideScene.emplace<GamePauseScene>(*this);
+        return;
 
       case SceneId::GameReady:
-        return std::make_unique<GameReadyScene>(*this);
+        mOverrideScene.emplace<GameReadyScene>(*this);
+        return;
     }
     assert(false);
-    return nullptr;
   }
 
 
@@ -51,27 +58,34 @@ namespace GameTetra {
 
 
   SceneManager::SceneManager(SceneId initialSceneId) :
-    mPtrGameScene(),
-    mPtrOverrideScene()
+    mGameScene(),
+    mOverrideScene()
   {
     DbgPrintf("ctor of GameTetra::SceneManager\n");
 
     gba::reg::DISPCNT = gba::DISPCNT::FORCE_BLANK;
 
+    // スコアと盤面はすぐにシーンが直接書き込むので、ここで消しておく
     BGClearMap<Config::ScrBase::BG0Score>();
     BGClearMap<Config::ScrBase::BG1Game>();
-    BGCopyMap<Config::ScrBase::BG1Pause>(Tile::bg::BGPause::MapData);
-    BGCopyMap<Config::ScrBase::BG2>(Tile::bg::BGFrame::MapData);
+    BGClearMap<Config::ScrBase::BG1GameBack>();
+
+    // ポーズ画面と枠は VBlank に転送し、枠（BG2）は転送し終えてから表示する
+    auto& vramUploadQueue = VRAMUploadQueue::GetInstance();
+    vramUploadQueue.Enqueue(gba::memory::VRAM_BGMAP<Config::ScrBase::BG1Pause>, Tile::bg::BGPause::MapData);
+    vramUploadQueue.Enqueue(gba::memory::VRAM_BGMAP<Config::ScrBase::BG2>, Tile::bg::BGFrame::MapData, [] () {
+      gba::reg::DISPCNT |= gba::DISPCNT::BG2;
+    });
 
     gba::reg::BG0CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG0Score) | Config::Priority::BG0;
     gba::reg::BG1CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG1Game) | Config::Priority::BG1;
     gba::reg::BG2CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG2) | Config::Priority::BG2;
-    gba::reg::DISPCNT = gba::DISPCNT::BGMODE0 | gba::DISPCNT::BG0 | gba::DISPCNT::BG1 | gba::DISPCNT::BG2 | gba::DISPCNT::BG3 | gba::DISPCNT::OBJ | gba::DISPCNT::OBJMAP1D;
+    gba::reg::DISPCNT = gba::DISPCNT::BGMODE0 | gba::DISPCNT::BG0 | gba::DISPCNT::BG1 | gba::DISPCNT::BG3 | gba::DISPCNT::OBJ | gba::DISPCNT::OBJMAP1D;
 
     gba::reg::BG0HOFS = Config::Position::ScoreScrollX;
     gba::reg::BG0VOFS = Config::Position::ScoreScrollY;
 
-    mPtrGameScene = std::make_unique<GameScene>(*this);
+    mGameScene.emplace(*this);
 
     SetScene(initialSceneId);
   }
@@ -80,8 +94,8 @@ namespace GameTetra {
   SceneManager::~SceneManager() {
     DbgPrintf("dtor of GameTetra::SceneManager\n");
 
-    mPtrOverrideScene.reset();
-    mPtrGameScene.reset();
+    mOverrideScene.emplace<std::monostate>();
+    mGameScene.reset();
 
     gba::reg::BG0HOFS = 0;
     gba::reg::BG0VOFS = 0;
@@ -90,40 +104,45 @@ namespace GameTetra {
 
   void SceneManager::SetScene(SceneId sceneId) {
     // ensure that the old scene is destructed before the new scene is created
-    mPtrOverrideScene.reset();
-    mPtrOverrideScene = CreateOverrideSceneFromSceneId(sceneId);
+    mOverrideScene.emplace<std::monostate>();
+    FrameCounter::SetSubScene(static_cast<unsigned int>(sceneId));
+    EmplaceOverrideSceneFromSceneId(sceneId);
   }
 
 
   GameScene& SceneManager::GetGameScene() {
-    return *mPtrGameScene;
+    return *mGameScene;
   }
 
 
   void SceneManager::GameRender() {
-    mPtrGameScene->Render();
+    mGameScene->Render();
   }
 
 
   void SceneManager::GameUpdate() {
-    mPtrGameScene->Update();
+    mGameScene->Update();
   }
 
 
   void SceneManager::Render() {
-    if (mPtrOverrideScene) {
-      mPtrOverrideScene->Render();
-    } else {
-      GameRender();
-    }
+    std::visit([this] (auto& scene) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(scene)>, std::monostate>) {
+        GameRender();
+      } else {
+        scene.Render();
+      }
+    }, mOverrideScene);
   }
 
 
   void SceneManager::Update() {
-    if (mPtrOverrideScene) {
-      mPtrOverrideScene->Update();
-    } else {
-      GameUpdate();
-    }
+    std::visit([this] (auto& scene) {
+      if constexpr (std::is_same_v<std::decay_t<decltype(scene)>, std::monostate>) {
+        GameUpdate();
+      } else {
+        scene.Update();
+      }
+    }, mOverrideScene);
   }
 }   // namespace GameTetra
@@ -1,29 +1,27 @@
 #pragma once
 
-#include <memory>
+#include "GameClearScene.hpp"
+#include "GameOverScene.hpp"
+#include "GamePauseScene.hpp"
+#include "GameReadyScene.hpp"
+#include "GameScene.hpp"
+#include "SceneId.hpp"
 
-
-namespace GameTetra {
-  enum class SceneId {
-    Game,
-    GameClear,
-    GameOver,
-    GamePause,
-    GameReady,
-  };
-
-
-  class Scene;
-  class GameScene;
+#include <optional>
+#include <variant>
 
 
+namespace GameTetra {
   class SceneManager {
     static constexpr auto InitialSceneId = SceneId::GameReady;
 
-    std::unique_ptr<GameScene> mPtrGameScene;      // just for deferring initialization
-    std::unique_ptr<Scene> mPtrOverrideScene;
+    // GameScene の上に重ねるシーン（std::monostate は SceneId::Game で、GameScene だけを動かす）
+    using OverrideSceneVariant = std::variant<std::monostate, GameClearScene, GameOverScene, GamePauseScene, GameReadyScene>;
+
+    std::optional<GameScene> mGameScene;      // just for deferring initialization
+    OverrideSceneVariant mOverrideScene;
 
-    std::unique_ptr<Scene> CreateOverrideSceneFromSceneId(SceneId sceneId);
+    void EmplaceOverrideSceneFromSceneId(SceneId sceneId);
 
   public:
     ~SceneManager();
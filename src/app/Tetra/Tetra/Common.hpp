@@ -4,6 +4,17 @@
 #include <cstdint>
 
 
+// 呼ばれる回数の多い関数と表に付ける配置の指定（GBA では IWRAM に置く）
+// コアはプラットフォームに依存しないので既定では何もせず、使う側がビルド設定で渡す（src/CMakeLists.txt）
+#ifndef TETRA_HOT_CODE
+#define TETRA_HOT_CODE
+#endif
+
+#ifndef TETRA_HOT_RODATA
+#define TETRA_HOT_RODATA
+#endif
+
+
 namespace Tetra {
   // Rotation:
   //   0: initial rotation
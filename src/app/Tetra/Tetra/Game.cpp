@@ -24,7 +24,7 @@ namespace Tetra {
     }
 
 
-    bool Game::Collide(std::size_t boardWidth, std::size_t boardHeight, const BlockType* blocks, MinoType minoType, const Point2D& position, Rotation rotation) {
+    TETRA_HOT_CODE bool Game::Collide(std::size_t boardWidth, std::size_t boardHeight, const BlockType* blocks, MinoType minoType, const Point2D& position, Rotation rotation) {
       const auto minoIndex = static_cast<std::size_t>(minoType);
       const auto& minoInfo = Mino[minoIndex].minos[rotation];
       if (const auto minPoint = position + minoInfo.minPoint; minPoint.x < 0 || minPoint.y < 0) {
@@ -46,16 +46,17 @@ namespace Tetra {
 
     Game::Game(const InitializeInfo& initializeInfo) :
       mInitialPositions(CalcInitialPositions(initializeInfo.boardWidth, initializeInfo.baseY)),
-      mBlocks(std::make_unique<BlockType[]>(initializeInfo.boardWidth * initializeInfo.boardHeight)),
-      mBlocksBeforeClear(std::make_unique<BlockType[]>(initializeInfo.boardWidth* initializeInfo.boardHeight)),
-      mBlocksAfterClear(std::make_unique<BlockType[]>(initializeInfo.boardWidth* initializeInfo.boardHeight)),
+      mOwnedBlockStorage(initializeInfo.blockStorage ? nullptr : std::make_unique<BlockType[]>(NumBlockBuffers * initializeInfo.boardWidth * initializeInfo.boardHeight)),
+      mBlocks(initializeInfo.blockStorage ? initializeInfo.blockStorage : mOwnedBlockStorage.get()),
+      mBlocksBeforeClear(mBlocks + initializeInfo.boardWidth * initializeInfo.boardHeight),
+      mBlocksAfterClear(mBlocksBeforeClear + initializeInfo.boardWidth * initializeInfo.boardHeight),
       mNextMinos{},
       mBoardInfo{
         false,
         initializeInfo.boardWidth,
         initializeInfo.boardHeight,
         initializeInfo.baseY,
-        mBlocks.get(),
+        mBlocks,
         0,
         mNextMinos,
         std::nullopt,
@@ -75,10 +76,13 @@ namespace Tetra {
       mBackToBackCount(0),
       mLastOperationRotation(false),
       mLastRotationWallKickOffsetIndex(0),
-      mMinoFactory(initializeInfo.minoFactory)
+      mMinoFactory(initializeInfo.minoFactory),
+      mDirtyRows(0)
     {
+      assert(initializeInfo.boardHeight <= sizeof(RowMask) * 8);
+
       static_assert(static_cast<unsigned int>(BlockType::None) == 0);
-      std::memset(mBlocks.get(), 0, mBoardInfo.boardWidth * mBoardInfo.boardHeight * sizeof(BlockType));
+      std::memset(mBlocks, 0, mBoardInfo.boardWidth * mBoardInfo.boardHeight * sizeof(BlockType));
       for (unsigned int y = 0; y < mBoardInfo.boardHeight; y++) {
         GetBlockRef(Point2D{0, static_cast<int>(y)}) = BlockType::Wall;
         GetBlockRef(Point2D{static_cast<int>(mBoardInfo.boardWidth - 1), static_cast<int>(y)}) = BlockType::Wall;
@@ -91,6 +95,8 @@ namespace Tetra {
         mNextMinos.push_back(mMinoFactory(*this));
       }
 
+      MarkAllRowsDirty();
+
       // [1]
       ConsumeNextMino();
       InitializeNextMino();
@@ -106,6 +112,21 @@ namespace Tetra {
     }
 
 
+    Game::RowMask Game::GetDirtyRows() const {
+      return mDirtyRows;
+    }
+
+
+    void Game::ClearDirtyRows() {
+      mDirtyRows = 0;
+    }
+
+
+    void Game::MarkAllRowsDirty() {
+      mDirtyRows = mBoardInfo.boardHeight == sizeof(RowMask) * 8 ? ~RowMask{0} : (RowMask{1} << mBoardInfo.boardHeight) - 1;
+    }
+
+
     bool Game::Collide(MinoType minoType, const Point2D& position, Rotation rotation) const {
       return Collide(mBoardInfo.boardWidth, mBoardInfo.boardHeight, mBoardInfo.blocks, minoType, position, rotation);
     }
@@ -179,7 +200,7 @@ namespace Tetra {
     }
 
 
-    void Game::UpdatePosition() {
+    TETRA_HOT_CODE void Game::UpdatePosition() {
       // update ghost position
       // bit inefficient
       Point2D ghostPosition = mBoardInfo.currentPosition;
@@ -353,6 +374,7 @@ namespace Tetra {
       for (const auto& relativePointPosition : minoInfo.points) {
         const auto pointPosition = mBoardInfo.currentPosition + relativePointPosition;
         GetBlockRef(pointPosition) = MinoTypeToBlockTypeTable[minoIndex];
+        mDirtyRows |= RowMask{1} << pointPosition.y;
       }
 
       unsigned int clearedLines[4] = {};
@@ -579,8 +601,8 @@ namespace Tetra {
       if (numClearedLines) {
         const bool backToBack = numClearedLines == 4 || tSpin != TSpin::None;
 
-        std::memcpy(mBlocksBeforeClear.get(), mBlocks.get(), mBoardInfo.boardWidth * mBoardInfo.boardHeight * sizeof(BlockType));
-        std::memcpy(mBlocksAfterClear.get(), mBlocks.get(), mBoardInfo.boardWidth * mBoardInfo.boardHeight * sizeof(BlockType));
+        std::memcpy(mBlocksBeforeClear, mBlocks, mBoardInfo.boardWidth * mBoardInfo.boardHeight * sizeof(BlockType));
+        std::memcpy(mBlocksAfterClear, mBlocks, mBoardInfo.boardWidth * mBoardInfo.boardHeight * sizeof(BlockType));
 
         for (unsigned int i = 0; i < numClearedLines; i++) {
           const unsigned int y = clearedLines[i];
@@ -591,15 +613,18 @@ namespace Tetra {
           }
           /*/
           static_assert(static_cast<unsigned int>(BlockType::None) == 0);
-          std::memset(mBlocksAfterClear.get() + (y * mBoardInfo.boardWidth + 1), 0, (mBoardInfo.boardWidth - 2) * sizeof(BlockType));
+          std::memset(mBlocksAfterClear + (y * mBoardInfo.boardWidth + 1), 0, (mBoardInfo.boardWidth - 2) * sizeof(BlockType));
           //*/
 
-          std::memmove(mBlocks.get() + mBoardInfo.boardWidth, mBlocks.get(), mBoardInfo.boardWidth * y * sizeof(BlockType));
+          std::memmove(mBlocks + mBoardInfo.boardWidth, mBlocks, mBoardInfo.boardWidth * y * sizeof(BlockType));
         }
 
+        // every row above the lowest cleared line has been shifted down
+        mDirtyRows |= (RowMask{2} << clearedLines[numClearedLines - 1]) - 1;
+
         // clean top
         static_assert(static_cast<unsigned int>(BlockType::None) == 0);
-        std::memset(mBlocks.get(), 0, mBoardInfo.boardWidth * numClearedLines * sizeof(BlockType));
+        std::memset(mBlocks, 0, mBoardInfo.boardWidth * numClearedLines * sizeof(BlockType));
         for (unsigned int y = 0; y < numClearedLines; y++) {
           GetBlockRef(Point2D{0, static_cast<int>(y)}) = BlockType::Wall;
           GetBlockRef(Point2D{static_cast<int>(mBoardInfo.boardWidth - 1), static_cast<int>(y)}) = BlockType::Wall;
@@ -609,7 +634,7 @@ namespace Tetra {
 
         mLastLineClearInfo = LineClearInfo{
           numClearedLines,
-          mRenLineCount + numClearedLines,
+          static_cast<unsigned int>(mRenLineCount + numClearedLines),
           {
             clearedLines[0],
             clearedLines[1],
@@ -622,9 +647,9 @@ namespace Tetra {
           backToBack ? mBackToBackCount : 0,
           mBoardInfo.boardWidth,
           mBoardInfo.boardHeight,
-          mBlocksBeforeClear.get(),
-          mBlocksAfterClear.get(),
-          mBlocks.get(),
+          mBlocksBeforeClear,
+          mBlocksAfterClear,
+          mBlocks,
         };
 
         Event::LineClear::DispatchEvent(mLastLineClearInfo);
@@ -154,6 +154,7 @@ namespace Tetra {
 
     public:
       using MinoFactory = std::function<MinoType(const Game& game)>;
+      using RowMask = std::uint64_t;    // bit y corresponds to row y of the board
       using EventListener = std::function<void(Game& game, void* data)>;
 
       struct InitializeInfo {
@@ -162,13 +163,17 @@ namespace Tetra {
         unsigned int baseY;
         std::size_t numNexts;
         MinoFactory minoFactory;
+        BlockType* blockStorage = nullptr;    // NumBlockBuffers * boardWidth * boardHeight blocks to use instead of allocating them
       };
 
+      static constexpr std::size_t NumBlockBuffers = 3;   // mBlocks, mBlocksBeforeClear, mBlocksAfterClear
+
     private:
       std::array<Point2D, NumMinoTypes> mInitialPositions;
-      std::unique_ptr<BlockType[]> mBlocks;
-      std::unique_ptr<BlockType[]> mBlocksBeforeClear;
-      std::unique_ptr<BlockType[]> mBlocksAfterClear;
+      std::unique_ptr<BlockType[]> mOwnedBlockStorage;    // empty if InitializeInfo::blockStorage is given
+      BlockType* mBlocks;
+      BlockType* mBlocksBeforeClear;
+      BlockType* mBlocksAfterClear;
       std::deque<MinoType> mNextMinos;
       BoardInfo mBoardInfo;
       GameStatistics mGameStatistics;
@@ -179,27 +184,36 @@ namespace Tetra {
       bool mLastOperationRotation;
       unsigned int mLastRotationWallKickOffsetIndex;
       MinoFactory mMinoFactory;
+      RowMask mDirtyRows;
 
       BlockType& GetBlockRef(const Point2D& position);
       void DispatchBoardUpdateEvent();
       void DispatchStatisticsUpdateEvent();
       void GameOver();
       void ConsumeNextMino();
-      void UpdatePosition();
+      TETRA_HOT_CODE void UpdatePosition();
       void InitializeNextMino();
       bool Move(const Offset2D& offset, bool hardDrop);
       bool Rotate(RotationDirection rotationDirection);
 
     public:
-      static bool Collide(std::size_t boardWidth, std::size_t boardHeight, const BlockType* blocks, MinoType minoType, const Point2D& position, Rotation rotation);;
+      TETRA_HOT_CODE static bool Collide(std::size_t boardWidth, std::size_t boardHeight, const BlockType* blocks, MinoType minoType, const Point2D& position, Rotation rotation);
 
       Game(const InitializeInfo& initializeInfo);
+      Game(const Game&) = delete;
+      Game& operator=(const Game&) = delete;
 
       const BoardInfo& GetBoardInfo() const;
       const GameStatistics& GetGameStatistics() const;
 
       BlockType GetBlock(const Point2D& position) const;
 
+      // rows whose blocks have changed since the last ClearDirtyRows() call (set by Lock, line clears and MarkAllRowsDirty)
+      // the current mino is not part of the blocks, so its movement does not make rows dirty
+      RowMask GetDirtyRows() const;
+      void ClearDirtyRows();
+      void MarkAllRowsDirty();
+
       bool Collide(MinoType minoType, const Point2D& position, Rotation rotation) const;
       bool Collide(const Point2D& position, Rotation rotation) const;
 
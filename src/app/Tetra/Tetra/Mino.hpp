@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 
 #include "Common.hpp"
@@ -33,6 +34,39 @@ namespace Tetra {
   };
 
 
+  // 定数表に置くための Offset2D（-128 ~ 127）、そのまま Offset2D として計算に使える
+  struct PackedOffset2D {
+    std::int8_t x;
+    std::int8_t y;
+
+    constexpr operator Offset2D() const noexcept {
+      return Offset2D{x, y};
+    }
+  };
+
+  using PackedWallKickOffsets = std::array<PackedOffset2D, NumWallKickPatterns>;
+
+  // RotatedMinos を詰めたもの（Tetra::Mino）、メンバの名前と意味は RotatedMinos と同じ
+  // 1回転あたり 140 バイトが 36 バイトになり、表全体を IWRAM に置ける
+  struct PackedRotatedMinos {
+    struct Mino {
+      std::uint8_t width;
+      std::uint8_t height;
+      PackedOffset2D minPoint;
+      PackedOffset2D maxPoint;
+      std::uint16_t bitPattern;
+      std::array<PackedOffset2D, NumMinoCells> points;
+      PackedWallKickOffsets wallKickOffsetsRight;
+      PackedWallKickOffsets wallKickOffsetsLeft;
+    };
+
+    std::uint8_t size;
+    std::array<Mino, NumRotationPatterns> minos;
+  };
+
+  static_assert(sizeof(PackedRotatedMinos::Mino) == 36);
+
+
   namespace InternalImpl {
     constexpr unsigned int FlipFlagX = 1 << 0;
     constexpr unsigned int FlipFlagY = 1 << 1;
@@ -238,59 +272,104 @@ namespace Tetra {
         rotatedMinos,
       };
     }
+
+
+    constexpr PackedOffset2D PackOffset2D(const Offset2D& offset) {
+      assert(offset.x >= INT8_MIN && offset.x <= INT8_MAX);
+      assert(offset.y >= INT8_MIN && offset.y <= INT8_MAX);
+
+      return PackedOffset2D{
+        static_cast<std::int8_t>(offset.x),
+        static_cast<std::int8_t>(offset.y),
+      };
+    }
+
+
+    template<std::size_t N>
+    constexpr std::array<PackedOffset2D, N> PackOffsets(const std::array<Offset2D, N>& offsets) {
+      std::array<PackedOffset2D, N> packedOffsets{};
+      for (std::size_t i = 0; i < N; i++) {
+        packedOffsets[i] = PackOffset2D(offsets[i]);
+      }
+      return packedOffsets;
+    }
+
+
+    constexpr PackedRotatedMinos PackRotatedMinos(const RotatedMinos& rotatedMinos) {
+      PackedRotatedMinos packedRotatedMinos{};
+      packedRotatedMinos.size = static_cast<std::uint8_t>(rotatedMinos.size);
+      for (Rotation i = 0; i < NumRotationPatterns; i++) {
+        const auto& mino = rotatedMinos.minos[i];
+
+        assert(mino.bitPattern <= UINT16_MAX);
+
+        packedRotatedMinos.minos[i] = PackedRotatedMinos::Mino{
+          static_cast<std::uint8_t>(mino.width),
+          static_cast<std::uint8_t>(mino.height),
+          PackOffset2D(mino.minPoint),
+          PackOffset2D(mino.maxPoint),
+          static_cast<std::uint16_t>(mino.bitPattern),
+          PackOffsets(mino.points),
+          PackOffsets(mino.wallKickOffsetsRight),
+          PackOffsets(mino.wallKickOffsetsLeft),
+        };
+      }
+      return packedRotatedMinos;
+    }
   }
 
 
 
-  constexpr std::array<RotatedMinos, NumMinoTypes> Mino{
+  // one copy shared by all translation units, in fast memory (TETRA_HOT_RODATA) as Game::Collide() reads it on every test
+  TETRA_HOT_RODATA inline constexpr std::array<PackedRotatedMinos, NumMinoTypes> Mino{
     // I
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       0, 0, 0, 0,
       1, 1, 1, 1,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsIMino),
+    }, InternalImpl::WallKickOffsetsIMino)),
     // O
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       1, 1, 0, 0,
       1, 1, 0, 0,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsBasic),
+    }, InternalImpl::WallKickOffsetsBasic)),
     // S
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       0, 1, 1, 0,
       1, 1, 0, 0,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsBasic),
+    }, InternalImpl::WallKickOffsetsBasic)),
     // Z
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       1, 1, 0, 0,
       0, 1, 1, 0,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsBasic),
+    }, InternalImpl::WallKickOffsetsBasic)),
     // J
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       1, 0, 0, 0,
       1, 1, 1, 0,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsBasic),
+    }, InternalImpl::WallKickOffsetsBasic)),
     // L
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       0, 0, 1, 0,
       1, 1, 1, 0,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsBasic),
+    }, InternalImpl::WallKickOffsetsBasic)),
     // T
-    InternalImpl::CreateRotatedMinos({
+    InternalImpl::PackRotatedMinos(InternalImpl::CreateRotatedMinos({
       0, 1, 0, 0,
       1, 1, 1, 0,
       0, 0, 0, 0,
       0, 0, 0, 0,
-    }, InternalImpl::WallKickOffsetsBasic),
+    }, InternalImpl::WallKickOffsetsBasic)),
   };
 }
@@ -3,6 +3,15 @@
 #include <gba.hpp>
 #include <image/bg.hpp>
 
+#include <cstdint>
+#include <iterator>
+
+
+// 文字 c を表示するBGマップのエントリ
+inline std::uint16_t FontTile(char c) {
+  return gba::BGMAP::TEXT::PALETTE(Tile::bg::Font::Palette) | gba::BGMAP::TEXT::TILE(Tile::bg::Font::FirstTileIndex + static_cast<unsigned char>(c));
+}
+
 
 template<unsigned int ScreenBaseBlock, unsigned int MapWidth = 32>
 void TilePrint(const char* string, unsigned int x, unsigned int y) {
@@ -16,9 +25,115 @@ void TilePrint(const char* string, unsigned int x, unsigned int y) {
       currentY++;
     } else {
       //
-      gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock>[currentY * MapWidth + currentX] = gba::BGMAP::TEXT::PALETTE(Tile::bg::Font::Palette) | gba::BGMAP::TEXT::TILE(Tile::bg::Font::FirstTileIndex + static_cast<unsigned char>(*ptr));
+      gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock>[currentY * MapWidth + currentX] = FontTile(*ptr);
       currentX++;
     }
     ptr++;
   }
 }
+
+
+// 空白を count 文字書き込む（printf の桁揃えの代わり）
+template<unsigned int ScreenBaseBlock, unsigned int MapWidth = 32>
+void TilePrintSpace(unsigned int x, unsigned int y, unsigned int count) {
+  const auto map = gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock> + y * MapWidth + x;
+  for (unsigned int i = 0; i < count; i++) {
+    map[i] = FontTile(' ');
+  }
+}
+
+
+namespace TilePrintInternal {
+  // value / 10 と value % 10
+  // 81920 未満なら逆数の掛け算（x * 0xCCCD >> 19 == x / 10）、それ以上は BIOS の Div を使う
+  inline unsigned int DivMod10(unsigned int value, unsigned int& mod) {
+    if (value < 81920) {
+      const unsigned int quotient = (value * 0xCCCDu) >> 19;
+      mod = value - quotient * 10;
+      return quotient;
+    }
+
+    int intMod;
+    const auto quotient = static_cast<unsigned int>(gba::bios::Div(static_cast<int>(value), 10, intMod));
+    mod = static_cast<unsigned int>(intMod);
+    return quotient;
+  }
+
+  // 10^0 から 10^9
+  constexpr unsigned int PowersOf10[]{1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+  // value を width 桁で右詰めにした各桁の文字を、右から順に put(桁の位置, 文字) で渡す
+  // width 桁に収まらない値は 9 を並べた値（4桁なら 9999）にする、value は 2^31 未満であること
+  template<typename F>
+  inline void ForEachDigit(unsigned int value, unsigned int width, char padding, F put) {
+    if (width < std::size(PowersOf10) && value >= PowersOf10[width]) {
+      value = PowersOf10[width] - 1;
+    }
+
+    for (unsigned int i = width; i > 0; i--) {
+      if (value == 0 && i != width) {
+        put(i - 1, padding);
+        continue;
+      }
+
+      unsigned int digit;
+      value = DivMod10(value, digit);
+      put(i - 1, static_cast<char>('0' + digit));
+    }
+  }
+}   // namespace TilePrintInternal
+
+
+// printf("%*u") の代わり、value を width 桁で右詰めにして直接BGマップに書き込む
+// printf と違って width 桁を超えては書かず、収まらない値は 9 を並べて表示する（12345 を4桁なら 9999）
+template<unsigned int ScreenBaseBlock, unsigned int MapWidth = 32>
+void TilePrintNumber(unsigned int value, unsigned int x, unsigned int y, unsigned int width, char padding = ' ') {
+  const auto map = gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock> + y * MapWidth + x;
+  TilePrintInternal::ForEachDigit(value, width, padding, [map] (unsigned int i, char c) {
+    map[i] = FontTile(c);
+  });
+}
+
+
+// TilePrintNumber() の文字列版、buffer には width + 1 文字以上書き込めること
+inline void FormatNumber(char* buffer, unsigned int value, unsigned int width, char padding = ' ') {
+  TilePrintInternal::ForEachDigit(value, width, padding, [buffer] (unsigned int i, char c) {
+    buffer[i] = c;
+  });
+  buffer[width] = '\0';
+}
+
+
+// 値が変わったときだけ描き直す数値の表示欄
+template<unsigned int ScreenBaseBlock, unsigned int MapWidth = 32>
+class TileNumberField {
+  unsigned int mX;
+  unsigned int mY;
+  unsigned int mWidth;
+  unsigned int mValue;
+  bool mValid;      // mValue が表示されている
+
+public:
+  TileNumberField(unsigned int x, unsigned int y, unsigned int width) :
+    mX(x),
+    mY(y),
+    mWidth(width),
+    mValue(0),
+    mValid(false)
+  {}
+
+  void Print(unsigned int value) {
+    if (mValid && value == mValue) {
+      return;
+    }
+
+    TilePrintNumber<ScreenBaseBlock, MapWidth>(value, mX, mY, mWidth);
+    mValue = value;
+    mValid = true;
+  }
+
+  // 他の描画で上書きされたときに呼ぶ、次の Print() で必ず描き直す
+  void Invalidate() {
+    mValid = false;
+  }
+};
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "TilePrint.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+#include <gba.hpp>
+
+
+// BGマップに文字で描くメニュー・リザルト画面用の UI 部品
+// 各部品は表示中の内容を覚えておき、内容が変わったとき（dirty）だけ Render() でタイルを書き込む
+//
+// 使い方：
+//   - シーンの Update() で TileUI::Update() を呼ぶと、表示元（source）に結びついた部品が値を読み直し、変わっていれば dirty になる
+//   - シーンの Render()（VBlank 直後に呼ばれる）で TileUI::Render() を呼ぶと、dirty な部品の書き込みだけがまとめて行われる
+// 何も変わらないフレームでは VRAM に一切触れない
+namespace TileUI {
+  enum class Align {
+    Left,
+    Right,
+  };
+
+
+  // Width x Height 文字の固定の表示欄
+  // 文字列の足りない部分は空白で埋めて、前の内容が残らないようにする
+  template<unsigned int ScreenBaseBlock, unsigned int Width, unsigned int Height = 1, unsigned int MapWidth = 32>
+  class TextBox {
+    // bit y = y 行目
+    using RowMask = std::uint32_t;
+    static_assert(Height <= sizeof(RowMask) * 8);
+
+    static constexpr RowMask AllRows = Height == sizeof(RowMask) * 8 ? ~RowMask{0} : (RowMask{1} << Height) - 1;
+
+    unsigned int mX;
+    unsigned int mY;
+    std::array<std::array<char, Width>, Height> mText;
+    RowMask mDirtyRows;
+
+  public:
+    TextBox(unsigned int x, unsigned int y, const char* text = "", Align align = Align::Left) :
+      mX(x),
+      mY(y),
+      mText{},
+      mDirtyRows(AllRows)
+    {
+      for (auto& line : mText) {
+        line.fill(' ');
+      }
+      SetLine(0, text, align);
+    }
+
+    void SetText(const char* text, Align align = Align::Left) {
+      SetLine(0, text, align);
+    }
+
+    // row 行目を text にする（Width 文字を超える分は切り捨てる）
+    void SetLine(unsigned int row, const char* text, Align align = Align::Left) {
+      unsigned int length = 0;
+      while (length < Width && text[length] != '\0') {
+        length++;
+      }
+
+      std::array<char, Width> line;
+      line.fill(' ');
+      const unsigned int offset = align == Align::Right ? Width - length : 0;
+      for (unsigned int i = 0; i < length; i++) {
+        line[offset + i] = text[i];
+      }
+
+      if (line == mText[row]) {
+        return;
+      }
+      mText[row] = line;
+      mDirtyRows |= RowMask{1} << row;
+    }
+
+    // 他の描画で上書きされたときに呼ぶ、次の Render() で全体を描き直す
+    void Invalidate() {
+      mDirtyRows = AllRows;
+    }
+
+    void Update() {}
+
+    void Render() {
+      if (!mDirtyRows) {
+        return;
+      }
+
+      for (unsigned int row = 0; row < Height; row++) {
+        if (!(mDirtyRows & (RowMask{1} << row))) {
+          continue;
+        }
+
+        const auto map = gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock> + (mY + row) * MapWidth + mX;
+        for (unsigned int i = 0; i < Width; i++) {
+          map[i] = FontTile(mText[row][i]);
+        }
+      }
+      mDirtyRows = 0;
+    }
+  };
+
+
+  // source() の値を format() で文字列にして表示する Width 文字の表示欄
+  // 文字列を作り直すのは値が変わったときだけ（T は == で比較できること）
+  template<unsigned int ScreenBaseBlock, unsigned int Width, typename T, unsigned int MapWidth = 32>
+  class Value {
+  public:
+    using Source = std::function<T()>;
+    using Format = void (*)(char* buffer, T value);     // buffer には Width + 1 文字まで書き込める
+
+  private:
+    TextBox<ScreenBaseBlock, Width, 1, MapWidth> mTextBox;
+    Source mSource;
+    Format mFormat;
+    Align mAlign;
+    T mValue;
+
+  public:
+    Value(unsigned int x, unsigned int y, Source source, Format format, Align align = Align::Left) :
+      mTextBox(x, y),
+      mSource(source),
+      mFormat(format),
+      mAlign(align),
+      mValue(mSource())
+    {
+      SetText();
+    }
+
+    void Invalidate() {
+      mTextBox.Invalidate();
+    }
+
+    void Update() {
+      const T value = mSource();
+      if (value == mValue) {
+        return;
+      }
+      mValue = value;
+      SetText();
+    }
+
+    void Render() {
+      mTextBox.Render();
+    }
+
+  private:
+    void SetText() {
+      char buffer[Width + 1] = {};
+      mFormat(buffer, mValue);
+      mTextBox.SetText(buffer, mAlign);
+    }
+  };
+
+
+  // 縦に並んだ NumItems 個の項目の、source() 番目の左に出す矢印
+  // 項目 i の矢印は (x, rows[i])、選ばれていない項目のところは空白にする
+  template<unsigned int ScreenBaseBlock, unsigned int NumItems, unsigned int MapWidth = 32>
+  class Cursor {
+  public:
+    using Source = std::function<unsigned int()>;
+
+  private:
+    static constexpr char Arrow = '>';
+
+    unsigned int mX;
+    std::array<unsigned int, NumItems> mRows;
+    Source mSource;
+    unsigned int mIndex;
+    unsigned int mRenderedIndex;    // 矢印を描いてある項目（全体を描き直すときは NumItems）
+
+  public:
+    Cursor(unsigned int x, const std::array<unsigned int, NumItems>& rows, Source source) :
+      mX(x),
+      mRows(rows),
+      mSource(source),
+      mIndex(mSource()),
+      mRenderedIndex(NumItems)
+    {}
+
+    void Invalidate() {
+      mRenderedIndex = NumItems;
+    }
+
+    void Update() {
+      mIndex = mSource();
+    }
+
+    void Render() {
+      if (mIndex == mRenderedIndex) {
+        return;
+      }
+
+      const auto map = gba::pointer_memory::VRAM_BGMAP<ScreenBaseBlock> + mX;
+      if (mRenderedIndex == NumItems) {
+        for (const auto y : mRows) {
+          map[y * MapWidth] = FontTile(' ');
+        }
+      } else {
+        map[mRows[mRenderedIndex] * MapWidth] = FontTile(' ');
+      }
+      map[mRows[mIndex] * MapWidth] = FontTile(Arrow);
+      mRenderedIndex = mIndex;
+    }
+  };
+
+
+  template<typename... Widgets>
+  void Update(Widgets&... widgets) {
+    (widgets.Update(), ...);
+  }
+
+  template<typename... Widgets>
+  void Render(Widgets&... widgets) {
+    (widgets.Render(), ...);
+  }
+}   // namespace TileUI
@@ -17,7 +17,7 @@
 #include <image/bg.hpp>
 
 #include <cassert>
-#include <cstdio>
+#include <initializer_list>
 
 
 namespace Root {
@@ -26,11 +26,23 @@ namespace Root {
 
   TitleScene::TitleScene(SceneManager& sceneManager) :
     Scene(sceneManager),
-    mSelection(Item::NewGame)
+    mSelection(Item::NewGame),
+    mMenuCursor(Config::Title::MenuTextScreenX, {Config::Title::MenuTextScreenY, Config::Title::MenuTextScreenY + 2}, [this] () {
+      return static_cast<unsigned int>(mSelection);
+    })
   {
     gba::reg::DISPCNT = gba::DISPCNT::FORCE_BLANK;
 
-    BGCopyMap<Config::ScrBase::BG0Title>(Tile::bg::BGTitle::MapData);
+    // 背景と文字は変わらないのでここで描いておき、Render() では矢印だけを描き直す
+    DecompressLZ77VRAM(gba::memory::VRAM_BGMAP<Config::ScrBase::BG0Title>, Tile::bg::BGTitle::MapDataLZ77);
+
+    unsigned int y = Config::Title::MenuTextScreenY;
+    for (const auto key : {"  NEW GAME", "  CONFIG"}) {
+      TilePrint<Config::ScrBase::BG0Title>(key, Config::Title::MenuTextScreenX, y);
+      y += 2;
+    }
+
+    TilePrint<Config::ScrBase::BG0Title>(VersionDisplay, gba::lcd::TileRealWidth - sizeof(VersionDisplay) - 1, gba::lcd::TileRealHeight - 2);
 
     gba::reg::BG0CNT = gba::BGCNT::COLOR16 | gba::BGCNT::SIZE0 | gba::BGCNT::CHARBASE(Config::CharBase) | gba::BGCNT::SCRBASE(Config::ScrBase::BG0Title) | Config::Priority::BG0;
 
@@ -39,24 +51,7 @@ namespace Root {
 
 
   void TitleScene::Render() {
-    BGCopyMap<Config::ScrBase::BG0Title>(Tile::bg::BGTitle::MapData);
-
-    unsigned int y = Config::Title::MenuTextScreenY;
-    unsigned int itemCount = 0;
-    const auto PrintMenuLine = [this, &y, &itemCount] (const char* key) {
-      const auto selectArrow = itemCount == static_cast<unsigned int>(mSelection) ? '>' : ' ';
-
-      static char buffer[16];
-      std::snprintf(buffer, sizeof(buffer), "%c %s", selectArrow, key);
-      TilePrint<Config::ScrBase::BG0Title>(buffer, Config::Title::MenuTextScreenX, y);
-      itemCount++;
-      y += 2;
-    };
-
-    PrintMenuLine("NEW GAME");
-    PrintMenuLine("CONFIG");
-
-    TilePrint<Config::ScrBase::BG0Title>(VersionDisplay, gba::lcd::TileRealWidth - sizeof(VersionDisplay) - 1, gba::lcd::TileRealHeight - 2);
+    TileUI::Render(mMenuCursor);
   }
 
 
@@ -99,5 +94,7 @@ namespace Root {
       SoundManager::GetInstance().Play(SoundManager::Channel::A, Sound::common_cursor);
       RotateEnumRight(mSelection, Item::End);
     }
+
+    TileUI::Update(mMenuCursor);
   }
 }   // namespace Root
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Config.hpp"
 #include "Scene.hpp"
+#include "TileUI.hpp"
 #include "Signal/SignalBase.hpp"
 
 #include <memory>
@@ -16,6 +18,8 @@ namespace Root {
 
     Item mSelection;
 
+    TileUI::Cursor<Config::ScrBase::BG0Title, static_cast<unsigned int>(Item::End)> mMenuCursor;
+
   public:
     TitleScene(SceneManager& sceneManager);
 
@@ -3,13 +3,28 @@
 #include "CopyVRAM.hpp"
 #include "GameConfig.hpp"
 #include "Song.hpp"
+#include "VRAMUploadQueue.hpp"
 #include "Sound/MusicManager.hpp"
 
+#include <array>
+#include <cstdint>
+
 #include <gba.hpp>
 #include <image/bg_background.hpp>
 
 
 namespace Root {
+  namespace {
+    static_assert(Tile::bg_background::BGBackgroundGray::MapDataBytes == 0x800);
+    static_assert(Tile::bg_background::BGBackgroundFlame::MapDataBytes == 0x800);
+
+    // 背景のマップ（Diff16 + LZ77）を展開する所、VRAMUploadQueue が転送し終えるまで使われる
+    // 転送し終える前に次の背景で上書きしても、後の転送も同じ内容なので最後に選んだ背景になる
+    alignas(4) std::array<std::uint16_t, 0x800 / sizeof(std::uint16_t)> gBG3Map{};
+    std::array<std::uint32_t, (0x800 + 4) / sizeof(std::uint32_t)> gBG3MapWork{};
+  }
+
+
   void PlayMusicFromConfig() {
     auto& musicManager = MusicManager::GetInstance();
 
@@ -34,17 +49,23 @@ namespace Root {
 
 
   void SetBGFromConfig() {
+    // 表示中に 2KB のマップを書き換えると画面の途中で切り替わってしまうので、VBlank に転送する
+    auto& vramUploadQueue = VRAMUploadQueue::GetInstance();
+    constexpr auto BG3Map = gba::memory::VRAM_BGMAP<Config::ScrBase::BG3>;
+
     switch (GameConfig::GetGlobalConfig().background) {
       case GameConfig::Background::Black:
-        BGClearMap<Config::ScrBase::BG3>();
+        vramUploadQueue.EnqueueFill(BG3Map, 0, 0x800);
         break;
 
       case GameConfig::Background::Gray:
-        BGCopyMap<Config::ScrBase::BG3>(Tile::bg_background::BGBackgroundGray::MapData);
+        DecompressDiff16LZ77(gBG3Map.data(), Tile::bg_background::BGBackgroundGray::MapDataDiff16LZ77, gBG3MapWork);
+        vramUploadQueue.Enqueue(BG3Map, gBG3Map);
         break;
 
       case GameConfig::Background::Flame:
-        BGCopyMap<Config::ScrBase::BG3>(Tile::bg_background::BGBackgroundFlame::MapData);
+        DecompressDiff16LZ77(gBG3Map.data(), Tile::bg_background::BGBackgroundFlame::MapDataDiff16LZ77, gBG3MapWork);
+        vramUploadQueue.Enqueue(BG3Map, gBG3Map);
         break;
 
       default:
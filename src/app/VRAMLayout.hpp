@@ -0,0 +1,107 @@
+#pragma once
+
+#include "ShadowOAM.hpp"
+#include "StaticLayout.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <image/bg.hpp>
+#include <image/bg_background.hpp>
+#include <image/obj.hpp>
+
+
+// VRAM と OAM の割り当て
+// 各シーンが使うタイル、マップ、OBJ をここに要求（型）として並べ、位置は StaticLayout がコンパイル時に決める
+// 新しく領域が必要になったら要求を足すだけでよく、入りきらなければコンパイルエラーになる
+// （一覧は notes/vram.md）
+namespace VRAMLayout {
+  // BG の VRAM（0x06000000 ~ 0x06010000）はスクリーンブロック（2KB）単位で割り当てる
+  namespace BG {
+    constexpr std::size_t ScreenBlockBytes = 0x800;
+    constexpr std::size_t NumScreenBlocks = 0x10000 / ScreenBlockBytes;
+    constexpr std::size_t ScreenBlocksPerCharBlock = 0x4000 / ScreenBlockBytes;
+
+    constexpr std::size_t BlocksFor(std::size_t bytes) {
+      return (bytes + ScreenBlockBytes - 1) / ScreenBlockBytes;
+    }
+
+    // タイルはキャラクタブロックの境界から置く（残りのスクリーンブロックはマップに使われる）
+    template<std::size_t Bytes>
+    struct Tiles : StaticRequest<BlocksFor(Bytes), ScreenBlocksPerCharBlock> {};
+
+    // 32x32 のマップ1枚
+    struct Map : StaticRequest<1> {};
+
+    // 共通
+    struct CommonTiles : Tiles<Tile::bg::TileDataBytes> {};
+    struct BackgroundTiles : Tiles<Tile::bg_background::TileDataBytes> {};
+    struct BackgroundMap : Map {};          // BG3
+
+    // BG0 の文字表示
+    // Root::TitleScene、Root::ConfigScene、GameTetra::GameScene（スコア）、GameTetra::GameEndSceneBase（リザルト）は同時に表示しないので共有する
+    struct TextMap : Map {};
+
+    // GameTetra
+    struct BoardMap : Map {};               // BG1、盤面
+    struct BoardBackMap : Map {};           // BG1、盤面のダブルバッファの裏
+    struct ReadyMap : Map {};               // BG1、GameReadyScene
+    struct PauseMap : Map {};               // BG1、GamePauseScene
+    struct FrameMap : Map {};               // BG2、枠
+
+    using Layout = StaticLayout<NumScreenBlocks,
+      CommonTiles,
+      BackgroundTiles,
+      BackgroundMap,
+      TextMap,
+      BoardMap,
+      BoardBackMap,
+      ReadyMap,
+      PauseMap,
+      FrameMap>;
+
+    template<typename Request>
+    constexpr std::uint16_t CharBaseBlock = Layout::Offset<Request>() / ScreenBlocksPerCharBlock;
+
+    template<typename Request>
+    constexpr std::uint16_t ScreenBaseBlock = Layout::Offset<Request>();
+
+    static_assert(Layout::Offset<CommonTiles>() % ScreenBlocksPerCharBlock == 0);
+    static_assert(Layout::Offset<BackgroundTiles>() % ScreenBlocksPerCharBlock == 0);
+  }   // namespace BG
+
+
+  // OBJ のタイル（0x06010000 ~ 0x06018000）は 32 バイト（4bit カラーの1タイル）単位
+  namespace OBJTile {
+    constexpr std::size_t TileBytes = 32;
+    constexpr std::size_t NumTiles = 0x8000 / TileBytes;
+
+    struct CommonTiles : StaticRequest<(Tile::obj::TileDataBytes + TileBytes - 1) / TileBytes> {};
+
+    using Layout = StaticLayout<NumTiles, CommonTiles>;
+
+    // リソースの OBJ 属性のタイル番号は先頭に置いたときのもの
+    static_assert(Layout::Offset<CommonTiles>() == 0);
+  }   // namespace OBJTile
+
+
+  // OAM
+  // 番号が小さいものほど手前に表示されるので、重なりうるものは手前に出したい順に並べる
+  // 使う番号が前に詰まるほど ShadowOAM::Flush() で転送する範囲が狭くなる
+  namespace OAM {
+    // GameTetra
+    struct Effects : StaticRequest<16> {};        // GameTetra::EffectPool（T-Spin、REN などの文字）
+    struct LineClear : StaticRequest<28> {};      // ライン消去アニメ、1行につき GameTetra::Config::ObjId::LineClearDiff 個を4行分
+    struct HoldMino : StaticRequest<1> {};
+    struct NextMinos : StaticRequest<6> {};       // GameTetra::Config::Board::NumNexts 個
+
+    using Layout = StaticLayout<ShadowOAM::NumObjects,
+      Effects,
+      LineClear,
+      HoldMino,
+      NextMinos>;
+
+    template<typename Request>
+    constexpr std::uint16_t ObjId = Layout::Offset<Request>();
+  }   // namespace OAM
+}   // namespace VRAMLayout
@@ -0,0 +1,89 @@
+#include "VRAMUploadQueue.hpp"
+#include "CopyVRAM.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <gba.hpp>
+
+
+VRAMUploadQueue::VRAMUploadQueue() :
+  mJobs{},
+  mHead(0),
+  mCount(0)
+{}
+
+
+VRAMUploadQueue& VRAMUploadQueue::GetInstance() {
+  static VRAMUploadQueue vramUploadQueue;
+  return vramUploadQueue;
+}
+
+
+void VRAMUploadQueue::Push(const Job& job) {
+  // 溢れた分を捨てないように、登録した順を保ったまま先頭から転送して空きを作る
+  while (mCount == MaxJobs) {
+    Process();
+  }
+  assert(mCount < MaxJobs);
+
+  assert(job.destAddress % sizeof(std::uint32_t) == 0);
+  assert(job.bytes != 0 && job.bytes % sizeof(std::uint32_t) == 0);
+
+  mJobs[(mHead + mCount) % MaxJobs] = job;
+  mCount++;
+}
+
+
+void VRAMUploadQueue::Enqueue(std::uintptr_t destAddress, const void* src, std::size_t bytes, Callback callback) {
+  assert(reinterpret_cast<std::uintptr_t>(src) % sizeof(std::uint32_t) == 0);
+
+  Push(Job{destAddress, src, 0, bytes, callback});
+}
+
+
+void VRAMUploadQueue::EnqueueFill(std::uintptr_t destAddress, std::uint16_t value, std::size_t bytes, Callback callback) {
+  Push(Job{destAddress, nullptr, value | (static_cast<std::uint32_t>(value) << 16), bytes, callback});
+}
+
+
+void VRAMUploadQueue::Process(std::size_t budget) {
+  while (mCount != 0 && budget != 0) {
+    auto& job = mJobs[mHead];
+
+    const std::size_t bytes = std::min(job.bytes, budget);
+    const std::size_t words = bytes / sizeof(std::uint32_t);
+
+    if (job.src) {
+      gba::DMA3Copy(job.src, reinterpret_cast<void*>(job.destAddress), words);
+
+      job.src = static_cast<const std::uint8_t*>(job.src) + bytes;
+    } else if (bytes % 32 == 0) {
+      gba::bios::CpuFastSet(&job.fillWord, reinterpret_cast<void*>(job.destAddress), words | CopyVRAMInternal::CpuSetFill);
+    } else {
+      gba::bios::CpuSet(&job.fillWord, reinterpret_cast<void*>(job.destAddress), words | CopyVRAMInternal::CpuSetFill | CopyVRAMInternal::CpuSet32Bit);
+    }
+
+    job.destAddress += bytes;
+    job.bytes -= bytes;
+    budget -= bytes;
+
+    if (job.bytes != 0) {
+      break;
+    }
+
+    // コールバックの中から Enqueue() されてもよいように、先に取り除いておく
+    const Callback callback = std::move(job.callback);
+    job.callback = nullptr;
+    mHead = (mHead + 1) % MaxJobs;
+    mCount--;
+
+    if (callback) {
+      callback();
+    }
+  }
+}
+
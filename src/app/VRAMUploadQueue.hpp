@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include <gba.hpp>
+
+
+// VRAM（タイル、マップ、パレット）への転送を溜めておき、VBlank ごとに BytesPerFrame バイトずつ転送する
+// （Root::SceneManager::WaitForVBlank() が VBlank 明けに毎フレーム Process() を呼んでいる）
+// 画面を FORCE_BLANK にして一度に転送する代わりに使う、転送中もメインループ（入力、サウンド、アニメーション）は止まらない
+//
+// 転送は登録した順に行い、1つの転送が終わるとそのコールバックを呼ぶ
+// 転送元は転送し終わるまで有効なこと（画像リソースのような静的なデータを想定している）
+// 転送先を CPU や別の DMA でも書き換える場合は、順序が入れ替わらないよう転送し終える（コールバックが呼ばれる）のを待ってから書き込むこと
+// MaxJobs を超えて登録すると、空きができるまで古いものからその場で転送する（VBlank の外なら画面が乱れるが、転送は抜けない）
+class VRAMUploadQueue {
+public:
+  using Callback = std::function<void()>;
+
+  static constexpr std::size_t MaxJobs = 16;
+
+  // VBlank（約 83,000 サイクル）のうち転送に使う量、EWRAM から VRAM への DMA は1ワード8サイクル程度
+  static constexpr std::size_t BytesPerFrame = 8 * 1024;
+
+private:
+  static_assert(BytesPerFrame % 32 == 0);
+
+  struct Job {
+    std::uintptr_t destAddress;
+    const void* src;            // nullptr ならフィル
+    std::uint32_t fillWord;
+    std::size_t bytes;          // 残りのバイト数
+    Callback callback;
+  };
+
+  // リングバッファ
+  std::array<Job, MaxJobs> mJobs;
+  std::size_t mHead;
+  std::size_t mCount;
+
+  VRAMUploadQueue();
+
+  void Push(const Job& job);
+
+public:
+  VRAMUploadQueue(const VRAMUploadQueue&) = delete;
+  VRAMUploadQueue(VRAMUploadQueue&&) = delete;
+  VRAMUploadQueue& operator=(const VRAMUploadQueue&) = delete;
+  VRAMUploadQueue& operator=(VRAMUploadQueue&&) = delete;
+
+  static VRAMUploadQueue& GetInstance();
+
+  // src から destAddress へ bytes バイト（4の倍数）、どちらも4バイト境界にあること
+  void Enqueue(std::uintptr_t destAddress, const void* src, std::size_t bytes, Callback callback = nullptr);
+
+  template<typename T, std::size_t S>
+  void Enqueue(std::uintptr_t destAddress, const std::array<T, S>& src, Callback callback = nullptr) {
+    Enqueue(destAddress, src.data(), sizeof(T) * S, callback);
+  }
+
+  // destAddress から bytes バイト（4の倍数）を value で埋める
+  void EnqueueFill(std::uintptr_t destAddress, std::uint16_t value, std::size_t bytes, Callback callback = nullptr);
+
+  // 最大 budget バイト転送する、VBlank 中に呼ぶこと
+  void Process(std::size_t budget = BytesPerFrame);
+};
@@ -4,12 +4,14 @@
 #include "gba/address.hpp"
 #include "gba/bios.hpp"
 #include "gba/const.hpp"
+#include "gba/dma.hpp"
 #include "gba/irq.hpp"
 #include "gba/lcd.hpp"
 #include "gba/memory.hpp"
 #include "gba/pointer.hpp"
 #include "gba/register.hpp"
 #include "gba/rgb.hpp"
+#include "gba/section.hpp"
 #include "gba/template_pointer.hpp"
 #include "gba/template_register.hpp"
 #include "gba/type.hpp"
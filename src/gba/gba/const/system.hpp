@@ -11,8 +11,56 @@ namespace gba {
     // https://problemkaputt.de/gbatek.htm#gbasystemcontrol
 
     // WAITCNT - Waitstate Control (R/W)
-    // TODO
-    namespace WAITCNT {}
+    namespace WAITCNT {
+      // SRAM Wait Control (0..3 = 4,3,2,8 cycles)
+      namespace SRAM {
+        constexpr std::uint16_t WAIT_4      = 0 <<  0;    // SRAM Wait Control (4 cycles)
+        constexpr std::uint16_t WAIT_3      = 1 <<  0;    // SRAM Wait Control (3 cycles)
+        constexpr std::uint16_t WAIT_2      = 2 <<  0;    // SRAM Wait Control (2 cycles)
+        constexpr std::uint16_t WAIT_8      = 3 <<  0;    // SRAM Wait Control (8 cycles)
+      }
+
+      // Wait State 0 (0x08000000 ~ 0x09FFFFFF)
+      namespace WS0 {
+        constexpr std::uint16_t FIRST_4     = 0 <<  2;    // Wait State 0 First Access (4 cycles)
+        constexpr std::uint16_t FIRST_3     = 1 <<  2;    // Wait State 0 First Access (3 cycles)
+        constexpr std::uint16_t FIRST_2     = 2 <<  2;    // Wait State 0 First Access (2 cycles)
+        constexpr std::uint16_t FIRST_8     = 3 <<  2;    // Wait State 0 First Access (8 cycles)
+        constexpr std::uint16_t SECOND_2    = 0 <<  4;    // Wait State 0 Second Access (2 cycles)
+        constexpr std::uint16_t SECOND_1    = 1 <<  4;    // Wait State 0 Second Access (1 cycle)
+      }
+
+      // Wait State 1 (0x0A000000 ~ 0x0BFFFFFF)
+      namespace WS1 {
+        constexpr std::uint16_t FIRST_4     = 0 <<  5;    // Wait State 1 First Access (4 cycles)
+        constexpr std::uint16_t FIRST_3     = 1 <<  5;    // Wait State 1 First Access (3 cycles)
+        constexpr std::uint16_t FIRST_2     = 2 <<  5;    // Wait State 1 First Access (2 cycles)
+        constexpr std::uint16_t FIRST_8     = 3 <<  5;    // Wait State 1 First Access (8 cycles)
+        constexpr std::uint16_t SECOND_4    = 0 <<  7;    // Wait State 1 Second Access (4 cycles)
+        constexpr std::uint16_t SECOND_1    = 1 <<  7;    // Wait State 1 Second Access (1 cycle)
+      }
+
+      // Wait State 2 (0x0C000000 ~ 0x0DFFFFFF)
+      namespace WS2 {
+        constexpr std::uint16_t FIRST_4     = 0 <<  8;    // Wait State 2 First Access (4 cycles)
+        constexpr std::uint16_t FIRST_3     = 1 <<  8;    // Wait State 2 First Access (3 cycles)
+        constexpr std::uint16_t FIRST_2     = 2 <<  8;    // Wait State 2 First Access (2 cycles)
+        constexpr std::uint16_t FIRST_8     = 3 <<  8;    // Wait State 2 First Access (8 cycles)
+        constexpr std::uint16_t SECOND_8    = 0 << 10;    // Wait State 2 Second Access (8 cycles)
+        constexpr std::uint16_t SECOND_1    = 1 << 10;    // Wait State 2 Second Access (1 cycle)
+      }
+
+      // PHI Terminal Output (0..3 = Disable, 4.19MHz, 8.38MHz, 16.78MHz)
+      namespace PHI {
+        constexpr std::uint16_t DISABLE     = 0 << 11;    // PHI Terminal Output (Disable)
+        constexpr std::uint16_t MHZ_4       = 1 << 11;    // PHI Terminal Output (4.19MHz)
+        constexpr std::uint16_t MHZ_8       = 2 << 11;    // PHI Terminal Output (8.38MHz)
+        constexpr std::uint16_t MHZ_16      = 3 << 11;    // PHI Terminal Output (16.78MHz)
+      }
+
+      constexpr std::uint16_t PREFETCH      = 1 << 14;    // Game Pak Prefetch Buffer (Enable)
+      constexpr std::uint16_t GAMEPAK_CGB   = 1 << 15;    // Game Pak Type Flag (Read Only) (CGB)
+    }
   }   // inline namespace constant
 }   // namespace gba
 
@@ -0,0 +1,19 @@
+#include <cassert>
+#include <cstdint>
+
+#include "dma.hpp"
+#include "register.hpp"
+#include "const/dma.hpp"
+
+
+namespace gba {
+  void DMA3Copy(const void* src, void* dest, std::uint32_t words) {
+    // DMA3CNT_L の 0 は 0x10000 ワード
+    assert(words != 0 && words <= 0x10000);
+
+    reg::DMA3SAD = src;
+    reg::DMA3DAD = dest;
+    reg::DMA3CNT_L = static_cast<std::uint16_t>(words);
+    reg::DMA3CNT_H = DMACNT_H::DESTADDR::INC | DMACNT_H::SRCADDR::INC | DMACNT_H::TYPE_32BIT | DMACNT_H::IMMEDIATE | DMACNT_H::ENABLE;
+  }
+}   // namespace gba
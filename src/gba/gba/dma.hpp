@@ -0,0 +1,14 @@
+#ifndef _gba_dma_hpp_
+#define _gba_dma_hpp_
+
+#include <cstdint>
+
+
+namespace gba {
+  // DMA3 で src から dest へ words ワード（32bit 単位、1 以上 0x10000 以下）を即時転送する
+  // src と dest は4バイト境界に置くこと、転送し終わるまで CPU は止まる
+  // ホストでは host/host/dma.cpp が memcpy で置き換える
+  void DMA3Copy(const void* src, void* dest, std::uint32_t words);
+}   // namespace gba
+
+#endif
@@ -56,9 +56,15 @@ _copy_and_jump_to_ram_if_executing_rom:
 .thumb
   mov r0, pc
   lsl r0, #5          @ Are we running from ROM (0x8000000 or higher) ?
-  bcs .JumpToRAM      @ Yes, so need to do a copy.
+  bcs .CheckLinkedToROM
   bx lr               @ No
 
+.CheckLinkedToROM:
+  ldr r0, = _copy_and_jump_to_ram_if_executing_rom
+  lsl r0, #5          @ Are we linked to ROM (gba_rom.ls) ?
+  bcc .JumpToRAM      @ No, so need to do a copy.
+  bx lr               @ Yes, so run in place.
+
 @-------------------------------------------------------------------------------
 @ We were started in ROM, silly emulators. :P
 @ So we need to copy to ExWRAM.
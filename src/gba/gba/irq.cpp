@@ -1,20 +1,131 @@
+#include <array>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 
+#include "irq.hpp"
 #include "register.hpp"
+#include "section.hpp"
 #include "type.hpp"
+#include "const/interrupt.hpp"
+
+
+namespace gba::irq {
+  // irq_dispatch.s が読む表の1項目（並びと大きさを変えるときは irq_dispatch.s も直すこと）
+  struct HandlerEntry {
+    std::uint16_t flags;          // 0 なら表の終わり
+    std::uint16_t nestedIE;       // ハンドラの実行中に許す割り込み（IE との AND）、0 なら入れ子にしない
+    isr handler;
+  };
+
+  static_assert(sizeof(HandlerEntry) == 8 && offsetof(HandlerEntry, nestedIE) == 2 && offsetof(HandlerEntry, handler) == 4);
+}   // namespace gba::irq
+
+
+extern "C" {
+  // priority の順に並べ、終わりに flags が 0 の項目を置く
+  IWRAM_DATA std::array<gba::irq::HandlerEntry, gba::irq::MaxHandlers + 1> _irq_handler_table{};
+
+  void _irq_dispatch();
+}
 
 
 namespace gba::irq {
   namespace {
     isr gIsr;
 
+    // _irq_handler_table と同じ並びの priority と nestable（登録するときにしか使わない）
+    std::array<unsigned int, MaxHandlers> gPriorities;
+    std::array<bool, MaxHandlers> gNestables;
+    std::size_t gNumHandlers = 0;
+
     __attribute__((target("arm"))) void armIsr() {
       gIsr();
     }
+
+
+    // 入れ子にできるハンドラに、自分より前（priority の小さい）のハンドラの割り込みを許す
+    void UpdateNestedIE() {
+      std::uint16_t higherFlags = 0;
+      for (std::size_t i = 0; i < gNumHandlers; i++) {
+        _irq_handler_table[i].nestedIE = gNestables[i] ? higherFlags : 0;
+        higherFlags |= _irq_handler_table[i].flags;
+      }
+    }
+
+
+    void RemoveEntry(std::size_t index) {
+      for (std::size_t i = index; i < gNumHandlers; i++) {
+        _irq_handler_table[i] = _irq_handler_table[i + 1];
+        if (i + 1 < gNumHandlers) {
+          gPriorities[i] = gPriorities[i + 1];
+          gNestables[i] = gNestables[i + 1];
+        }
+      }
+      gNumHandlers--;
+    }
   }   // namespace
 
+
   __attribute__((target("arm"))) void SetISR(isr isr) {
     gIsr = isr;
     gba::reg::ISRAD = armIsr;
   }
+
+
+  void SetHandler(std::uint16_t flags, isr handler, unsigned int priority, bool nestable) {
+    assert(flags != 0 && handler);
+
+    // 表を書き換えている間に振り分けないように
+    const std::uint16_t ime = gba::reg::IME;
+    gba::reg::IME = 0;
+
+    ClearHandler(flags);
+    assert(gNumHandlers < MaxHandlers);
+
+    // 同じ priority なら後から登録したものを後ろにする
+    std::size_t index = gNumHandlers;
+    while (index > 0 && gPriorities[index - 1] > priority) {
+      _irq_handler_table[index] = _irq_handler_table[index - 1];
+      gPriorities[index] = gPriorities[index - 1];
+      gNestables[index] = gNestables[index - 1];
+      index--;
+    }
+    _irq_handler_table[index] = HandlerEntry{flags, 0, handler};
+    gPriorities[index] = priority;
+    gNestables[index] = nestable;
+    gNumHandlers++;
+    _irq_handler_table[gNumHandlers] = HandlerEntry{0, 0, nullptr};
+
+    UpdateNestedIE();
+
+    gba::reg::IME = ime;
+  }
+
+
+  // flags のビットを受け持つハンドラの登録を外す（ほかのビットも受け持っていれば、そのビットだけ外す）
+  void ClearHandler(std::uint16_t flags) {
+    const std::uint16_t ime = gba::reg::IME;
+    gba::reg::IME = 0;
+
+    std::size_t i = 0;
+    while (i < gNumHandlers) {
+      auto& entry = _irq_handler_table[i];
+      entry.flags &= ~flags;
+      if (entry.flags == 0) {
+        RemoveEntry(i);
+      } else {
+        i++;
+      }
+    }
+
+    UpdateNestedIE();
+
+    gba::reg::IME = ime;
+  }
+
+
+  void UseDispatcher() {
+    gba::reg::ISRAD = _irq_dispatch;
+  }
 }   // namespace gba::irq
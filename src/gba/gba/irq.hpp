@@ -1,11 +1,32 @@
 #ifndef _gba_irq_hpp_
 #define _gba_irq_hpp_
 
+#include <cstddef>
+#include <cstdint>
+
 #include "type.hpp"
 
 
 namespace gba::irq {
+  // ISR を1つだけ登録する（割り込みの種類の判別と IF / INTCHK への書き込みは ISR が行う）
   void SetISR(isr isr);
+
+
+  // 割り込みの種類ごとにハンドラを登録して、表で振り分ける
+  // 振り分けは IWRAM の ARM コード（irq_dispatch.s）で、UseDispatcher() で ISRAD に設定する
+  //
+  //   同時に来たものは priority の小さい順に1つずつ処理する（1つ処理して戻ると、残りですぐにまた割り込む）
+  //   IF と INTCHK（IntrWait / VBlankIntrWait 用）はハンドラを呼ぶ前に書くので、ハンドラは何もしなくてよい
+  //   ハンドラは System モード（ユーザーのスタック）で呼ぶ
+  //   nestable なら、ハンドラの実行中も priority の小さいハンドラの割り込みを受け付ける
+  //   （実行中は IE をそれらに絞る、ハンドラの中で IE を書き換えても戻るときに元に戻る）
+  //
+  // 登録した種類の IE は呼ぶ側が立てること、登録していないものが来たら IF を書いて無視する
+  constexpr std::size_t MaxHandlers = 14;
+
+  void SetHandler(std::uint16_t flags, isr handler, unsigned int priority, bool nestable = false);
+  void ClearHandler(std::uint16_t flags);
+  void UseDispatcher();
 }   // namespace gba::irq
 
 #endif
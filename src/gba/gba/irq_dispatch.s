@@ -0,0 +1,76 @@
+@ IRQ の振り分け（gba::irq::UseDispatcher() で ISRAD に設定する）
+@
+@ BIOS の IRQ ハンドラから IRQ モード、ARM で呼ばれる（r0-r3, r12, lr は BIOS が IRQ モードのスタックに退避している）
+@ _irq_handler_table（irq.cpp）を priority の順に見て、最初に IE & IF と重なった項目を処理する
+@
+@ 1. IF と INTCHK（IntrWait / VBlankIntrWait 用）に処理するビットを書く
+@ 2. System モードに切り替えてハンドラを呼ぶ（IRQ モードのスタックは小さいので、ユーザーのスタックを使う）
+@    nestedIE が 0 でなければ IE をそれと AND して IRQ を許可する（優先度の高い割り込みだけが入れ子で入る）
+@ 3. IRQ モードに戻し、IE（入れ子にしたときだけ）、SPSR、LR を戻して BIOS に戻る
+
+  .syntax unified
+  .arm
+  .section .iwram_code, "ax", %progbits
+  .align 2
+
+  .global _irq_dispatch
+  .type _irq_dispatch, %function
+_irq_dispatch:
+  mov   r0, #0x04000000
+  add   r0, r0, #0x200          @ r0 = &IE
+  ldr   r1, [r0]                @ r1 = IE | (IF << 16)
+  and   r1, r1, r1, lsr #16     @ r1 = IE & IF
+
+  ldr   r2, =_irq_handler_table
+.LFind:
+  ldrh  r3, [r2], #8            @ r3 = flags, r2 = 次の項目
+  ands  r12, r3, r1
+  bne   .LFound
+  cmp   r3, #0
+  bne   .LFind
+
+  @ ハンドラがないので IF を書いて戻る
+  strh  r1, [r0, #2]
+  bx    lr
+
+.LFound:
+  @ r12 = 処理するビット
+  strh  r12, [r0, #2]           @ IF
+  ldr   r3, =0x03007FF8
+  ldrh  r1, [r3]
+  orr   r1, r1, r12
+  strh  r1, [r3]                @ INTCHK |= r12
+
+  ldr   r12, [r2, #-4]          @ r12 = handler
+  ldrh  r3, [r2, #-6]           @ r3 = nestedIE
+  mrs   r2, spsr
+
+  mov   r1, #0                  @ r1 = 戻す IE（入れ子にしないなら 0）
+  cmp   r3, #0
+  ldrhne r1, [r0]
+  andne r3, r3, r1
+  strhne r3, [r0]               @ IE &= nestedIE
+
+  mov   r3, lr
+  mov   r0, #0x9F               @ System モード、IRQ 禁止
+  bicne r0, r0, #0x80           @ 入れ子にするなら IRQ 許可
+  msr   cpsr_c, r0
+
+  push  {r1-r3, lr}             @ IE, SPSR_irq, LR_irq, LR_sys
+  mov   lr, pc
+  bx    r12
+  pop   {r1-r3, lr}
+
+  mov   r0, #0x92               @ IRQ モード、IRQ 禁止
+  msr   cpsr_c, r0
+  msr   spsr_cf, r2
+
+  cmp   r1, #0
+  movne r0, #0x04000000
+  addne r0, r0, #0x200
+  strhne r1, [r0]               @ IE を戻す
+
+  bx    r3
+
+  .size _irq_dispatch, . - _irq_dispatch
+  .pool
@@ -0,0 +1,25 @@
+#ifndef _gba_section_hpp_
+#define _gba_section_hpp_
+
+// IWRAM（0x03000000、32bit バス、ウェイトなし）に置く関数と変数の指定
+// 宣言と定義の両方に付ける
+//
+//   IWRAM_CODE    ARM 命令でコンパイルして .iwram_code に置く
+//                 EWRAM から BL では届かないので、呼ぶ側は long_call で（レジスタ経由で）呼ぶ
+//                 IWRAM から EWRAM の関数を呼ぶところはリンカが中継コードを挟む
+//   IWRAM_DATA    書き換える変数、.iwram_data に置く
+//   IWRAM_RODATA  定数、.iwram_rodata に置く（同じセクションに const と非 const を混ぜるとコンパイルエラーになる）
+//
+// 起動時に _start() がロード位置（EWRAM）からコピーする（gba.ls の .iwram）
+// ホストでは何もしない
+#if defined(GBA_HOST)
+#define IWRAM_CODE
+#define IWRAM_DATA
+#define IWRAM_RODATA
+#else
+#define IWRAM_CODE    __attribute__((section(".iwram_code"), long_call, target("arm")))
+#define IWRAM_DATA    __attribute__((section(".iwram_data")))
+#define IWRAM_RODATA  __attribute__((section(".iwram_rodata")))
+#endif
+
+#endif
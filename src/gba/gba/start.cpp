@@ -1,3 +1,4 @@
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -6,13 +7,41 @@
 #ifndef GBA_USE_CRT
 int main();
 
+// gba.ls / gba_rom.ls
+extern "C" std::uint32_t __iwram_start[];
+extern "C" std::uint32_t __iwram_end[];
+extern "C" const std::uint32_t __iwram_lma[];
+extern "C" std::uint32_t __data_start[];
+extern "C" std::uint32_t __data_end[];
+extern "C" const std::uint32_t __data_lma[];
+extern "C" std::uint32_t __bss_start[];
+extern "C" std::uint32_t __bss_end__[];
+
+namespace {
+  inline std::size_t SizeOf(const std::uint32_t* begin, const std::uint32_t* end) {
+    return reinterpret_cast<std::uintptr_t>(end) - reinterpret_cast<std::uintptr_t>(begin);
+  }
+}
+
 extern "C" __attribute__((target("arm"))) void _start() {
+  // IWRAM に置くコードとデータをロード位置からコピーする
+  std::memcpy(__iwram_start, __iwram_lma, SizeOf(__iwram_start, __iwram_end));
+
+  // ROM イメージでは .data は ROM にあり、.bss はイメージに含まれない
+  // マルチブートイメージでは .data はその場にある（ロード位置と同じなので memmove は何もしないのと同じ）
+  std::memmove(__data_start, __data_lma, SizeOf(__data_start, __data_end));
+  std::memset(__bss_start, 0, SizeOf(__bss_start, __bss_end__));
+
   main();
   gba::bios::Stop();
 }
 #endif
 
+// ROM から実行しているとき（マルチブートイメージは EWRAM にコピーしてから _start_ram() に来る）
 extern "C" __attribute__((target("arm"))) void _start_rom() {
+  // ROM のウェイトを 3/1 にしてプリフェッチを有効にする（初期値は 4/2）
+  gba::reg::WAITCNT = gba::WAITCNT::WS0::FIRST_3 | gba::WAITCNT::WS0::SECOND_1 | gba::WAITCNT::PREFETCH;
+
   _start();
 }
 
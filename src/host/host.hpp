@@ -0,0 +1,39 @@
+#ifndef _host_hpp_
+#define _host_hpp_
+
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+// ホスト（Linux等）で app/ をそのまま動かすためのプラットフォーム層
+// GBAのメモリマップ（I/O, パレット, VRAM, OAM, BIOS RAM）を同じアドレスに mmap して普通のメモリとして扱い、
+// BIOSコールとIRQはここで肩代わりする
+// DMA3 の転送（gba::DMA3Copy）は host/dma.cpp が memcpy で行う、I/O レジスタへの書き込みには副作用がない
+//
+// 環境変数:
+//   GBA_HOST_FRAMES  実行するフレーム数（省略時 3600）
+//   GBA_HOST_INPUT   キー入力スクリプトのパス（省略時は入力なし）
+//
+// キー入力スクリプトは1行に「フレーム番号 キー...」を書く（キーは A B SELECT START RIGHT LEFT UP DOWN R L）
+// そのフレームから次の行のフレームまで指定したキーが押されたままになる、'#' 以降はコメント
+//   0
+//   120  START
+//   125
+//   300  LEFT DOWN
+namespace host {
+  // 1フレームのサイクル数（228ライン * 1232サイクル）
+  constexpr std::uint32_t CyclesPerFrame = 280896;
+
+  // VBlank 1回分進める（VBlankIntrWait, IntrWait, Halt から呼ばれる）
+  // 指定フレーム数に達したら統計を出力して終了する
+  void StepFrame();
+
+  // 経過フレーム数
+  unsigned long GetFrameCount();
+
+  // IF にフラグを立て、IME と IE が許せば登録されたISRを呼ぶ
+  void RaiseIRQ(std::uint16_t flags);
+}   // namespace host
+
+#endif
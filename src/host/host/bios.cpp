@@ -0,0 +1,254 @@
+#include "../host.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <gba.hpp>
+
+
+// gba/gba/bios.cpp（swi呼び出し）のホスト版
+// アプリが使う可能性のあるものだけ実装している、それ以外（アフィン変換、サウンドドライバ、マルチブート等）は未定義のままにしてリンク時に気づけるようにする
+namespace gba::bios {
+  namespace {
+    std::uint32_t ReadU32(const std::uint8_t* ptr) {
+      return ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (static_cast<std::uint32_t>(ptr[3]) << 24);
+    }
+
+    // 解凍結果を8bit単位で書き込む（VRAM向けの16bit書き込み版もホストでは区別する必要がない）
+    void LZ77UnComp(const void* src, void* dest) {
+      const auto* ptrSrc = static_cast<const std::uint8_t*>(src);
+      auto* ptrDest = static_cast<std::uint8_t*>(dest);
+
+      const std::uint32_t size = ReadU32(ptrSrc) >> 8;
+      ptrSrc += 4;
+
+      std::uint32_t written = 0;
+      while (written < size) {
+        const std::uint8_t flags = *ptrSrc++;
+        for (unsigned int i = 0; i < 8 && written < size; i++) {
+          if (flags & (0x80 >> i)) {
+            const unsigned int length = (ptrSrc[0] >> 4) + 3;
+            const unsigned int disp = (((ptrSrc[0] & 0x0F) << 8) | ptrSrc[1]) + 1;
+            ptrSrc += 2;
+            for (unsigned int j = 0; j < length && written < size; j++, written++) {
+              ptrDest[written] = ptrDest[written - disp];
+            }
+          } else {
+            ptrDest[written++] = *ptrSrc++;
+          }
+        }
+      }
+    }
+
+    void RLUnComp(const void* src, void* dest) {
+      const auto* ptrSrc = static_cast<const std::uint8_t*>(src);
+      auto* ptrDest = static_cast<std::uint8_t*>(dest);
+
+      const std::uint32_t size = ReadU32(ptrSrc) >> 8;
+      ptrSrc += 4;
+
+      std::uint32_t written = 0;
+      while (written < size) {
+        const std::uint8_t flag = *ptrSrc++;
+        if (flag & 0x80) {
+          const unsigned int length = (flag & 0x7F) + 3;
+          const std::uint8_t data = *ptrSrc++;
+          for (unsigned int i = 0; i < length && written < size; i++) {
+            ptrDest[written++] = data;
+          }
+        } else {
+          const unsigned int length = (flag & 0x7F) + 1;
+          for (unsigned int i = 0; i < length && written < size; i++) {
+            ptrDest[written++] = *ptrSrc++;
+          }
+        }
+      }
+    }
+
+    template<typename T>
+    void DiffUnFilter(const void* src, void* dest) {
+      const auto* ptrSrc = static_cast<const std::uint8_t*>(src);
+      auto* ptrDest = static_cast<std::uint8_t*>(dest);
+
+      const std::uint32_t size = ReadU32(ptrSrc) >> 8;
+      ptrSrc += 4;
+
+      T value = 0;
+      for (std::uint32_t i = 0; i < size; i += sizeof(T)) {
+        T diff;
+        std::memcpy(&diff, ptrSrc + i, sizeof(T));
+        value = static_cast<T>(value + diff);
+        std::memcpy(ptrDest + i, &value, sizeof(T));
+      }
+    }
+  }   // namespace
+
+
+  // BIOS Reset Functions
+
+  void SoftReset() {
+    std::fprintf(stderr, "host: SoftReset\n");
+    std::exit(0);
+  }
+
+  void RegisterRamReset(unsigned char resetFlags) {
+    if (resetFlags & (1 << 0)) {
+      std::memset(reinterpret_cast<void*>(memory::WRAM_BOARD), 0, 0x40000);
+    }
+    if (resetFlags & (1 << 1)) {
+      std::memset(reinterpret_cast<void*>(memory::WRAM_CHIP), 0, 0x8000 - 0x200);
+    }
+    if (resetFlags & (1 << 2)) {
+      std::memset(reinterpret_cast<void*>(memory::PALETTE_BG), 0, 0x400);
+    }
+    if (resetFlags & (1 << 3)) {
+      std::memset(reinterpret_cast<void*>(memory::VRAM), 0, 0x18000);
+    }
+    if (resetFlags & (1 << 4)) {
+      std::memset(reinterpret_cast<void*>(memory::OAM), 0, 0x400);
+    }
+    reg::DISPCNT = 0x0080;
+  }
+
+  // BIOS Halt Functions
+
+  // 割り込み要因は VBlank しか再現していないので、どれも次の VBlank まで進める
+  void Halt() {
+    host::StepFrame();
+  }
+
+  void Stop() {
+    std::fprintf(stderr, "host: Stop\n");
+    std::exit(0);
+  }
+
+  void IntrWait([[maybe_unused]] bool discard, [[maybe_unused]] unsigned int interruptFlags) {
+    host::StepFrame();
+  }
+
+  void VBlankIntrWait() {
+    host::StepFrame();
+  }
+
+  // BIOS Arithmetic Functions
+
+  int Div(int num, int denom, int& mod, unsigned int& divAbs) {
+    const int div = num / denom;
+    mod = num % denom;
+    divAbs = static_cast<unsigned int>(div < 0 ? -div : div);
+    return div;
+  }
+
+  int Div(int num, int denom, int& mod) {
+    mod = num % denom;
+    return num / denom;
+  }
+
+  int Div(int num, int denom, unsigned int& divAbs) {
+    const int div = num / denom;
+    divAbs = static_cast<unsigned int>(div < 0 ? -div : div);
+    return div;
+  }
+
+  int Div(int num, int denom) {
+    return num / denom;
+  }
+
+  int DivArm(int denom, int num, int& mod, unsigned int& divAbs) {
+    return Div(num, denom, mod, divAbs);
+  }
+
+  int DivArm(int denom, int num, int& mod) {
+    return Div(num, denom, mod);
+  }
+
+  int DivArm(int denom, int num, unsigned int& divAbs) {
+    return Div(num, denom, divAbs);
+  }
+
+  int DivArm(int denom, int num) {
+    return Div(num, denom);
+  }
+
+  unsigned short Sqrt(unsigned int num) {
+    unsigned int root = 0;
+    for (unsigned int bit = 1u << 30; bit; bit >>= 2) {
+      if (num >= root + bit) {
+        num -= root + bit;
+        root = (root >> 1) + bit;
+      } else {
+        root >>= 1;
+      }
+    }
+    return static_cast<unsigned short>(root);
+  }
+
+  // BIOS Memory Copy
+
+  void CpuSet(const void* src, void* dest, unsigned int modeAndLength) {
+    const std::size_t count = modeAndLength & 0x1FFFFF;
+    const bool fill = modeAndLength & (1 << 24);
+    const std::size_t unit = (modeAndLength & (1 << 26)) ? 4 : 2;
+
+    const auto* ptrSrc = static_cast<const std::uint8_t*>(src);
+    auto* ptrDest = static_cast<std::uint8_t*>(dest);
+    for (std::size_t i = 0; i < count; i++) {
+      std::memcpy(ptrDest + i * unit, fill ? ptrSrc : ptrSrc + i * unit, unit);
+    }
+  }
+
+  void CpuFastSet(const void* src, void* dest, unsigned int modeAndLength) {
+    // rounded-up to multiple of 8 words
+    const std::size_t count = ((modeAndLength & 0x1FFFFF) + 7) & ~static_cast<std::size_t>(7);
+    const bool fill = modeAndLength & (1 << 24);
+
+    const auto* ptrSrc = static_cast<const std::uint8_t*>(src);
+    auto* ptrDest = static_cast<std::uint8_t*>(dest);
+    if (!fill) {
+      std::memmove(ptrDest, ptrSrc, count * 4);
+      return;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+      std::memcpy(ptrDest + i * 4, ptrSrc, 4);
+    }
+  }
+
+  // BIOS Misc Functions
+
+  unsigned int GetBiosChecksum() {
+    return 0xBAAE187F;
+  }
+
+  // BIOS Decompression Functions
+
+  void LZ77UnCompReadNormalWrite8bit(const void* src, void* dest) {
+    LZ77UnComp(src, dest);
+  }
+
+  void LZ77UnCompReadNormalWrite16bit(const void* src, void* dest) {
+    LZ77UnComp(src, dest);
+  }
+
+  void RLUnCompReadNormalWrite8bit(const void* src, void* dest) {
+    RLUnComp(src, dest);
+  }
+
+  void RLUnCompReadNormalWrite16bit(const void* src, void* dest) {
+    RLUnComp(src, dest);
+  }
+
+  void Diff8bitUnFilterWrite8bit(const void* src, void* dest) {
+    DiffUnFilter<std::uint8_t>(src, dest);
+  }
+
+  void Diff8bitUnFilterWrite16bit(const void* src, void* dest) {
+    DiffUnFilter<std::uint8_t>(src, dest);
+  }
+
+  void Diff16bitUnFilter(const void* src, void* dest) {
+    DiffUnFilter<std::uint16_t>(src, dest);
+  }
+}   // namespace gba::bios
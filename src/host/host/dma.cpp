@@ -0,0 +1,16 @@
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include <gba.hpp>
+
+
+// gba/gba/dma.cpp のホスト版
+// ホストのポインタは8バイトあって4バイトの DMA3SAD / DMA3DAD に収まらないので、レジスタには書かずにその場でコピーする
+namespace gba {
+  void DMA3Copy(const void* src, void* dest, std::uint32_t words) {
+    assert(words != 0 && words <= 0x10000);
+
+    std::memcpy(dest, src, words * sizeof(std::uint32_t));
+  }
+}   // namespace gba
@@ -0,0 +1,170 @@
+#include "../host.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include <gba.hpp>
+
+
+namespace host {
+  namespace {
+    struct InputEvent {
+      unsigned long frame;
+      std::uint16_t keys;     // 押されているキー（1=Pressed）
+    };
+
+    constexpr unsigned long DefaultNumFrames = 3600;
+
+    constexpr struct {
+      const char* name;
+      std::uint16_t key;
+    } KeyNames[]{
+      {"A", gba::KEYINPUT::A},
+      {"B", gba::KEYINPUT::B},
+      {"SELECT", gba::KEYINPUT::SELECT},
+      {"START", gba::KEYINPUT::START},
+      {"RIGHT", gba::KEYINPUT::RIGHT},
+      {"LEFT", gba::KEYINPUT::LEFT},
+      {"UP", gba::KEYINPUT::UP},
+      {"DOWN", gba::KEYINPUT::DOWN},
+      {"R", gba::KEYINPUT::R},
+      {"L", gba::KEYINPUT::L},
+    };
+
+    constexpr std::uint16_t AllKeys = 0x03FF;
+
+
+    std::vector<InputEvent> LoadInputScript(const char* path) {
+      std::vector<InputEvent> events;
+
+      std::FILE* const file = std::fopen(path, "r");
+      if (!file) {
+        std::fprintf(stderr, "host: cannot open input script %s\n", path);
+        std::exit(1);
+      }
+
+      char line[256];
+      unsigned int lineNumber = 0;
+      while (std::fgets(line, sizeof(line), file)) {
+        lineNumber++;
+
+        if (char* const comment = std::strchr(line, '#')) {
+          *comment = '\0';
+        }
+
+        char* token = std::strtok(line, " \t\r\n");
+        if (!token) {
+          continue;
+        }
+
+        InputEvent event{std::strtoul(token, nullptr, 10), 0};
+        while ((token = std::strtok(nullptr, " \t\r\n"))) {
+          bool found = false;
+          for (const auto& keyName : KeyNames) {
+            if (std::strcmp(token, keyName.name) == 0) {
+              event.keys |= keyName.key;
+              found = true;
+              break;
+            }
+          }
+          if (!found) {
+            std::fprintf(stderr, "host: %s:%u: unknown key %s\n", path, lineNumber, token);
+            std::exit(1);
+          }
+        }
+
+        if (!events.empty() && events.back().frame > event.frame) {
+          std::fprintf(stderr, "host: %s:%u: frames must be in ascending order\n", path, lineNumber);
+          std::exit(1);
+        }
+
+        events.push_back(event);
+      }
+
+      std::fclose(file);
+
+      return events;
+    }
+
+
+    class Frame {
+      unsigned long mFrameCount;
+      unsigned long mNumFrames;
+      std::uint32_t mCycleCount;
+      std::vector<InputEvent> mInputEvents;
+      std::size_t mInputIndex;
+      std::chrono::steady_clock::time_point mStartTime;
+
+    public:
+      Frame() :
+        mFrameCount(0),
+        mNumFrames(DefaultNumFrames),
+        mCycleCount(0),
+        mInputEvents(),
+        mInputIndex(0),
+        mStartTime(std::chrono::steady_clock::now())
+      {
+        if (const char* const frames = std::getenv("GBA_HOST_FRAMES")) {
+          mNumFrames = std::strtoul(frames, nullptr, 10);
+        }
+        if (const char* const input = std::getenv("GBA_HOST_INPUT")) {
+          mInputEvents = LoadInputScript(input);
+        }
+      }
+
+      unsigned long GetFrameCount() const {
+        return mFrameCount;
+      }
+
+      void Step() {
+        mFrameCount++;
+
+        if (mFrameCount >= mNumFrames) {
+          const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - mStartTime;
+          std::fprintf(stderr, "host: %lu frames in %.3f s (%.1f fps)\n", mFrameCount, elapsed.count(), mFrameCount / elapsed.count());
+          std::exit(0);
+        }
+
+        // cascaded TM2/TM3 (TIMING_1 + COUNTUP) as 32bit cycle counter
+        mCycleCount += CyclesPerFrame;
+        if (gba::reg::TM2CNT_H & gba::TMCNT_H::OPERATE) {
+          gba::reg::TM2CNT_L = static_cast<std::uint16_t>(mCycleCount);
+          gba::reg::TM3CNT_L = static_cast<std::uint16_t>(mCycleCount >> 16);
+        }
+
+        while (mInputIndex < mInputEvents.size() && mInputEvents[mInputIndex].frame <= mFrameCount) {
+          gba::reg::KEYINPUT = AllKeys & ~mInputEvents[mInputIndex].keys;
+          mInputIndex++;
+        }
+
+        gba::reg::VCOUNT = 160;
+        gba::reg::DISPSTAT = gba::reg::DISPSTAT | gba::DISPSTAT::IS_VBLANK;
+        if (gba::reg::DISPSTAT & gba::DISPSTAT::VBLANK_IRQ) {
+          RaiseIRQ(gba::IF::VBLANK);
+        }
+        gba::reg::DISPSTAT = gba::reg::DISPSTAT & ~gba::DISPSTAT::IS_VBLANK;
+        gba::reg::VCOUNT = 0;
+      }
+    };
+
+
+    Frame& GetFrame() {
+      static Frame frame;
+      return frame;
+    }
+  }   // namespace
+
+
+  void StepFrame() {
+    GetFrame().Step();
+  }
+
+
+  unsigned long GetFrameCount() {
+    return GetFrame().GetFrameCount();
+  }
+}   // namespace host
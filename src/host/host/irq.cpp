@@ -0,0 +1,94 @@
+#include "../host.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <gba.hpp>
+
+
+namespace gba::irq {
+  namespace {
+    isr gIsr;
+
+    struct HandlerEntry {
+      std::uint16_t flags;
+      isr handler;
+      unsigned int priority;
+    };
+
+    // priority の順
+    std::array<HandlerEntry, MaxHandlers> gHandlers;
+    std::size_t gNumHandlers = 0;
+
+
+    // gba/gba/irq_dispatch.s と同じ振り分け（ホストでは割り込みが入れ子にならないので nestable は無視する）
+    void Dispatch() {
+      while (const std::uint16_t pending = gba::reg::IE & gba::reg::IF) {
+        const auto itr = std::find_if(gHandlers.begin(), gHandlers.begin() + gNumHandlers, [pending] (const HandlerEntry& entry) {
+          return entry.flags & pending;
+        });
+        const std::uint16_t flags = itr != gHandlers.begin() + gNumHandlers ? itr->flags & pending : pending;
+
+        gba::reg::IF = gba::reg::IF & ~flags;
+        gba::reg::INTCHK = gba::reg::INTCHK | flags;
+
+        if (itr != gHandlers.begin() + gNumHandlers) {
+          itr->handler();
+        }
+      }
+    }
+  }   // namespace
+
+  // ISRAD は32bitのポインタ用なのでホストでは使わず、ここで保持する
+  void SetISR(isr isr) {
+    gIsr = isr;
+  }
+
+
+  void SetHandler(std::uint16_t flags, isr handler, unsigned int priority, [[maybe_unused]] bool nestable) {
+    assert(flags != 0 && handler);
+
+    ClearHandler(flags);
+    assert(gNumHandlers < MaxHandlers);
+
+    const auto itr = std::upper_bound(gHandlers.begin(), gHandlers.begin() + gNumHandlers, priority, [] (unsigned int priority, const HandlerEntry& entry) {
+      return priority < entry.priority;
+    });
+    std::move_backward(itr, gHandlers.begin() + gNumHandlers, gHandlers.begin() + gNumHandlers + 1);
+    *itr = HandlerEntry{flags, handler, priority};
+    gNumHandlers++;
+  }
+
+
+  void ClearHandler(std::uint16_t flags) {
+    for (std::size_t i = 0; i < gNumHandlers; i++) {
+      gHandlers[i].flags &= ~flags;
+    }
+    gNumHandlers = std::remove_if(gHandlers.begin(), gHandlers.begin() + gNumHandlers, [] (const HandlerEntry& entry) {
+      return entry.flags == 0;
+    }) - gHandlers.begin();
+  }
+
+
+  void UseDispatcher() {
+    gIsr = Dispatch;
+  }
+}   // namespace gba::irq
+
+
+namespace host {
+  void RaiseIRQ(std::uint16_t flags) {
+    gba::reg::IF = gba::reg::IF | flags;
+
+    if (!(gba::reg::IME & gba::IME::ENABLE) || !(gba::reg::IE & flags) || !gba::irq::gIsr) {
+      return;
+    }
+
+    // 実機の IF は1を書き込んだビットがクリアされるが、ここではISRが書いた値がそのまま残るのでISR後にクリアする
+    gba::irq::gIsr();
+    gba::reg::IF = 0;
+  }
+}   // namespace host
@@ -0,0 +1,44 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include <sys/mman.h>
+
+#include <gba.hpp>
+
+
+// app/ と gba/ は固定アドレスへの reinterpret_cast でハードウェアにアクセスするので、
+// そのアドレスに同じサイズの匿名メモリを割り当てておく
+// 静的初期化より前に走らせるため constructor の優先度を指定している
+namespace host {
+  namespace {
+    struct Region {
+      std::uintptr_t address;
+      std::size_t size;
+      const char* name;
+    };
+
+    constexpr Region Regions[]{
+      {gba::memory::WRAM_BOARD, 0x40000, "WRAM_BOARD"},
+      {gba::memory::WRAM_CHIP, 0x8000, "WRAM_CHIP"},
+      {gba::memory::IO, 0x1000, "IO"},
+      {gba::memory::PALETTE_BG, 0x1000, "PALETTE"},
+      {gba::memory::VRAM, 0x18000, "VRAM"},
+      {gba::memory::OAM, 0x1000, "OAM"},
+    };
+
+    __attribute__((constructor(101))) void MapMemory() {
+      for (const auto& region : Regions) {
+        void* const ptr = mmap(reinterpret_cast<void*>(region.address), region.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (ptr != reinterpret_cast<void*>(region.address)) {
+          std::fprintf(stderr, "host: failed to map %s at %08lX\n", region.name, static_cast<unsigned long>(region.address));
+          std::abort();
+        }
+      }
+
+      // キーは全て離した状態（0=Pressed）
+      gba::reg::KEYINPUT = 0x03FF;
+    }
+  }   // namespace
+}   // namespace host
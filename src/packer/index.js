@@ -0,0 +1,60 @@
+const fs = require('fs');
+const path = require('path');
+const { lz77 } = require(path.join(__dirname, '..', 'resources', 'compress.js'));
+
+
+// 圧縮したマルチブートイメージを作る
+// stub.bin（stub.s）の後ろに LZ77 で圧縮したイメージを付ける、起動すると stub が 0x02000000 に展開して実行する
+class Packer {
+  /**
+   * @param {string} stubPath
+   * @param {string} imagePath
+   * @param {string} outPath
+   */
+  constructor(stubPath, imagePath, outPath) {
+    const stub = Buffer.from(fs.readFileSync(stubPath));
+    const image = fs.readFileSync(imagePath);
+
+    // stub の末尾は圧縮後のサイズを読む位置（4バイト境界）
+    if (stub.length < Packer.HeaderRanges[Packer.HeaderRanges.length - 1][1] || stub.length % 4 !== 0) {
+      throw new Error(`unexpected stub size ${stub.length} (${stubPath})`);
+    }
+
+    // ヘッダは元のイメージのものを使う（BIOS が見る）
+    for (const [begin, end] of Packer.HeaderRanges) {
+      image.copy(stub, begin, begin, end);
+    }
+
+    const packed = lz77(image);
+
+    // 展開先（0x02000000 から）と、EWRAM の末尾に移した圧縮データが重なってはいけない
+    if (image.length + packed.length > Packer.EWRAMSize) {
+      throw new Error(`image too large to unpack in place (${image.length} + ${packed.length} bytes)`);
+    }
+
+    const size = Buffer.alloc(4);
+    size.writeUInt32LE(packed.length, 0);
+
+    const body = Buffer.concat([stub, size, packed]);
+    const buffer = Buffer.concat([body, Buffer.alloc((Packer.Alignment - body.length % Packer.Alignment) % Packer.Alignment, 0)]);
+
+    fs.writeFileSync(outPath, buffer);
+
+    console.log(`${path.basename(imagePath)}: ${image.length} bytes -> ${path.basename(outPath)}: ${buffer.length} bytes`);
+  }
+}
+
+Packer.HeaderRanges = [
+  [0x04, 0xC0],   // ROM header
+  [0xC4, 0xE0],   // multiboot header
+];
+Packer.EWRAMSize = 0x40000;
+Packer.Alignment = 0x100;     // same as ._ram_padding in gba.ls
+
+
+if (!process.argv[2] || !process.argv[3] || !process.argv[4]) {
+  console.log(`usage: node ${process.argv[1]} stub.bin final.bin final_packed.mb`);
+  process.exit(1);
+}
+
+new Packer(process.argv[2], process.argv[3], process.argv[4]);
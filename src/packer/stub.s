@@ -0,0 +1,70 @@
+@ 圧縮したマルチブートイメージ（final_packed.mb）の先頭に置く展開コード
+@
+@ index.js がこの後ろに [圧縮後のサイズ (32bit)] [LZ77 で圧縮した final.bin] を付け、
+@ ヘッダ（0x04 ~ 0xBF、0xC4 ~ 0xDF）を final.bin のものに差し替える
+@
+@ 1. 圧縮データを EWRAM の末尾へ移す（展開先の 0x02000000 と重ならないように）
+@ 2. 展開して飛ぶところ（trampoline）を IWRAM にコピーして、そこへ飛ぶ
+@ 3. BIOS の LZ77UnCompReadNormalWrite8bit で 0x02000000 に展開し、final.bin の ._entrypoint.ram に飛ぶ
+@
+@ EWRAM でも ROM でも動くよう、位置に依存しないコードにしている
+
+  .arm
+  .section .text
+
+  .org 0x00
+  b _unpack                       @ ROM
+
+  .org 0x04
+  .space 0xBC                     @ ROM header (copied from final.bin)
+
+  .org 0xC0
+  b _unpack                       @ multiboot
+
+  .org 0xC4
+  .space 0x1C                     @ multiboot header (copied from final.bin)
+
+  .org 0xE0
+  b _unpack                       @ joybus
+
+  .org 0xF0
+  b _unpack                       @ RAM
+
+_unpack:
+  @ r2 = packed data, r1 = its size (multiple of 4)
+  adr r2, _packed_size
+  ldr r1, [r2], #4
+
+  @ 1. copy backwards to the end of EWRAM, the regions may overlap
+  mov r3, #0x02040000
+  add r4, r2, r1
+.MovePacked:
+  ldr r5, [r4, #-4]!
+  str r5, [r3, #-4]!
+  cmp r4, r2
+  bhi .MovePacked
+
+  @ 2. copy the trampoline to IWRAM
+  adr r4, _trampoline
+  adr r5, _trampoline_end
+  mov r6, #0x03000000
+.CopyTrampoline:
+  ldr r7, [r4], #4
+  str r7, [r6], #4
+  cmp r4, r5
+  blo .CopyTrampoline
+
+  mov r0, r3                      @ r0 = packed data (moved)
+  mov r1, #0x02000000             @ r1 = destination
+  mov r6, #0x03000000
+  bx r6
+
+_trampoline:
+  swi 0x110000                    @ LZ77UnCompReadNormalWrite8bit
+  mov r0, #0x02000000
+  add r0, r0, #0xF0               @ ._entrypoint.ram of final.bin (see entrypoint.s)
+  bx r0
+_trampoline_end:
+
+  .align 2
+_packed_size:
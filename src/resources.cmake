@@ -0,0 +1,125 @@
+# generated resources (images, songs, sounds)
+# included from both the device build and the host build (host/CMakeLists.txt)
+# requires: TARGET_NAME, RES_DIR
+# defines: IMAGE_HEADERS, SONG_SOURCES, SOUND_SOURCES, ${TARGET_NAME}_resource_{image,song,sound}
+
+set(IMAGE_HEADERS
+  ${RES_DIR}/image/bg.hpp
+  ${RES_DIR}/image/bg_background.hpp
+  ${RES_DIR}/image/obj.hpp
+)
+
+FILE(GLOB SONG_RESOURCES ${RES_DIR}/song/*.mid)
+set(SONG_SOURCES ${SONG_RESOURCES})
+list(TRANSFORM SONG_SOURCES REPLACE \.mid$ .cpp)
+
+FILE(GLOB SOUND_RESOURCES ${RES_DIR}/sound/*.wav)
+set(SOUND_SOURCES ${SOUND_RESOURCES})
+list(TRANSFORM SOUND_SOURCES REPLACE \.wav$ .cpp)
+
+
+# resources/image
+
+function(add_image_command NAME TYPE)
+  # ARGN: [TILE_COMPRESSION none|lz77|rl] resources
+  # (map compression is the map_compression column of each CSV)
+  cmake_parse_arguments(IMAGE "" "TILE_COMPRESSION" "" ${ARGN})
+
+  if (NOT IMAGE_TILE_COMPRESSION)
+    set(IMAGE_TILE_COMPRESSION none)
+  endif()
+
+  set(FULLPATH_RESOURCES ${IMAGE_UNPARSED_ARGUMENTS})
+  list(TRANSFORM FULLPATH_RESOURCES PREPEND ${RES_DIR}/image/)
+
+  set(PNG_RESOURCES ${FULLPATH_RESOURCES})
+  list(TRANSFORM PNG_RESOURCES APPEND .png)
+
+  set(CSV_RESOURCES ${FULLPATH_RESOURCES})
+  list(TRANSFORM CSV_RESOURCES APPEND .csv)
+
+  add_custom_command(
+    OUTPUT ${RES_DIR}/image/${NAME}.hpp
+    WORKING_DIRECTORY ${RES_DIR}/image
+    COMMAND node index.js --tile-compression=${IMAGE_TILE_COMPRESSION} ${NAME} ${TYPE} ${PNG_RESOURCES}
+    DEPENDS
+      ${RES_DIR}/image/index.js
+      ${RES_DIR}/compress.js
+      ${PNG_RESOURCES}
+      ${CSV_RESOURCES}
+  )
+endfunction()
+
+add_image_command(bg bg
+  TILE_COMPRESSION lz77
+  title
+  frame
+  pause
+  unscii-8
+  text
+  block
+)
+
+add_image_command(bg_background bg
+  TILE_COMPRESSION lz77
+  background_gray
+  background_flame
+)
+
+add_image_command(obj obj
+  TILE_COMPRESSION lz77
+  empty64x64
+  effect
+)
+
+add_custom_target(${TARGET_NAME}_resource_image
+  SOURCES
+    ${IMAGE_HEADERS}
+)
+
+
+# resources/song
+
+foreach(SONG_RESOURCE ${SONG_RESOURCES})
+  string(REGEX REPLACE \.mid$ .cpp SONG_SOURCE ${SONG_RESOURCE})
+
+  add_custom_command(
+    OUTPUT ${SONG_SOURCE}
+    WORKING_DIRECTORY ${RES_DIR}/song
+    COMMAND node index.js ${SONG_RESOURCE}
+    DEPENDS
+      ${RES_DIR}/song/index.js
+      ${RES_DIR}/song/note.js
+      ${RES_DIR}/song/register.js
+      ${RES_DIR}/song/waveram.js
+      ${SONG_RESOURCE}
+  )
+endforeach(SONG_RESOURCE)
+
+add_custom_target(${TARGET_NAME}_resource_song
+  SOURCES
+    ${SONG_SOURCES}
+)
+
+
+# resources/sound
+
+math(EXPR SOUND_SAMPLING_RATE "32768 / 2" OUTPUT_FORMAT DECIMAL)
+
+foreach(SOUND_RESOURCE ${SOUND_RESOURCES})
+  string(REGEX REPLACE \.wav$ .cpp SOUND_SOURCE ${SOUND_RESOURCE})
+
+  add_custom_command(
+    OUTPUT ${SOUND_SOURCE}
+    WORKING_DIRECTORY ${RES_DIR}/sound
+    COMMAND node index.js ${SOUND_RESOURCE} ${SOUND_SAMPLING_RATE}
+    DEPENDS
+      ${RES_DIR}/sound/index.js
+      ${SOUND_RESOURCE}
+  )
+endforeach(SOUND_RESOURCE)
+
+add_custom_target(${TARGET_NAME}_resource_sound
+  SOURCES
+    ${SOUND_SOURCES}
+)
@@ -0,0 +1,190 @@
+// BIOS の展開ルーチン（gba/bios.hpp の LZ77UnComp* など）で展開できる形式への圧縮
+// https://problemkaputt.de/gbatek.htm#biosdecompressionfunctions
+
+
+const RL = {
+  Type: 0x30,
+  MinRun: 3,
+  MaxRun: 130,
+  MaxLiteral: 128,
+};
+
+const Diff16 = {
+  Type: 0x82,
+};
+
+const LZ77 = {
+  Type: 0x10,
+  MinLength: 3,
+  MaxLength: 18,
+  MaxDisp: 0x1000,
+  ChainLimit: 256,
+};
+
+
+/**
+ * BIOS の展開ルーチンのヘッダ（下位8bit が種類、上位24bit が展開後のサイズ）
+ * @param {number} type
+ * @param {number} size
+ * @returns {Buffer}
+ */
+function createHeader(type, size) {
+  if (size >= 0x1000000) {
+    throw new Error(`too large to compress (${size} bytes)`);
+  }
+
+  const header = Buffer.alloc(4);
+  header.writeUInt32LE((type | (size << 8)) >>> 0, 0);
+  return header;
+}
+
+
+/**
+ * 転送元は4バイト単位で読まれるので0で埋める
+ * @param {Buffer} buffer
+ * @returns {Buffer}
+ */
+function padTo4(buffer) {
+  return Buffer.concat([buffer, Buffer.alloc((4 - buffer.length % 4) % 4, 0)]);
+}
+
+
+/**
+ * LZ77 で圧縮する
+ * VRAM に展開する（LZ77UnCompReadNormalWrite16bit）場合は vram を true にすること
+ * （16bit 単位で書くので直前の1バイトは参照できない）
+ * @param {Buffer} data
+ * @param {{vram?: boolean}} [options]
+ * @returns {Buffer}
+ */
+function lz77(data, options = {}) {
+  const minDisp = options.vram ? 2 : 1;
+
+  // 3バイトのハッシュごとの最後の位置と、同じハッシュの1つ前の位置
+  const HashSize = 1 << 16;
+  const head = new Int32Array(HashSize).fill(-1);
+  const prev = new Int32Array(data.length).fill(-1);
+  const hashAt = i => ((data[i] << 8) ^ (data[i + 1] << 4) ^ data[i + 2]) & (HashSize - 1);
+  const insert = i => {
+    if (i + LZ77.MinLength <= data.length) {
+      const hash = hashAt(i);
+      prev[i] = head[hash];
+      head[hash] = i;
+    }
+  };
+
+  const out = [createHeader(LZ77.Type, data.length)];
+  let pos = 0;
+  while (pos < data.length) {
+    const block = [0];
+    for (let bit = 0; bit < 8 && pos < data.length; bit++) {
+      let bestLength = 0;
+      let bestDisp = 0;
+      if (pos + LZ77.MinLength <= data.length) {
+        const maxLength = Math.min(LZ77.MaxLength, data.length - pos);
+        let chain = 0;
+        for (let candidate = head[hashAt(pos)]; candidate >= 0 && chain < LZ77.ChainLimit; candidate = prev[candidate], chain++) {
+          const disp = pos - candidate;
+          if (disp > LZ77.MaxDisp) {
+            break;
+          }
+          if (disp < minDisp) {
+            continue;
+          }
+          let length = 0;
+          while (length < maxLength && data[candidate + length] === data[pos + length]) {
+            length++;
+          }
+          if (length > bestLength) {
+            bestLength = length;
+            bestDisp = disp;
+            if (length === maxLength) {
+              break;
+            }
+          }
+        }
+      }
+
+      if (bestLength >= LZ77.MinLength) {
+        block[0] |= 0x80 >> bit;
+        block.push(((bestLength - LZ77.MinLength) << 4) | ((bestDisp - 1) >> 8), (bestDisp - 1) & 0xFF);
+        for (let i = 0; i < bestLength; i++) {
+          insert(pos++);
+        }
+      } else {
+        block.push(data[pos]);
+        insert(pos++);
+      }
+    }
+    out.push(Buffer.from(block));
+  }
+
+  return padTo4(Buffer.concat(out));
+}
+
+
+/**
+ * ランレングスで圧縮する（RLUnCompReadNormalWrite8bit / RLUnCompReadNormalWrite16bit）
+ * @param {Buffer} data
+ * @returns {Buffer}
+ */
+function rl(data) {
+  const out = [createHeader(RL.Type, data.length)];
+  let literal = [];
+  const flushLiteral = () => {
+    while (literal.length) {
+      const chunk = literal.splice(0, RL.MaxLiteral);
+      out.push(Buffer.from([chunk.length - 1, ...chunk]));
+    }
+  };
+
+  let pos = 0;
+  while (pos < data.length) {
+    let run = 1;
+    while (run < RL.MaxRun && pos + run < data.length && data[pos + run] === data[pos]) {
+      run++;
+    }
+
+    if (run >= RL.MinRun) {
+      flushLiteral();
+      out.push(Buffer.from([0x80 | (run - RL.MinRun), data[pos]]));
+      pos += run;
+    } else {
+      literal.push(data[pos]);
+      pos++;
+    }
+  }
+  flushLiteral();
+
+  return padTo4(Buffer.concat(out));
+}
+
+
+/**
+ * 16bit 単位の差分をとる（Diff16bitUnFilter で元に戻す）
+ * 圧縮はしないので、lz77() などと組み合わせて使う
+ * @param {Buffer} data
+ * @returns {Buffer}
+ */
+function diff16(data) {
+  if (data.length % 2 !== 0) {
+    throw new Error('data size must be a multiple of 2');
+  }
+
+  const out = Buffer.alloc(data.length);
+  let prev = 0;
+  for (let i = 0; i < data.length; i += 2) {
+    const value = data.readUInt16LE(i);
+    out.writeUInt16LE((value - prev) & 0xFFFF, i);
+    prev = value;
+  }
+
+  return Buffer.concat([createHeader(Diff16.Type, data.length), out]);
+}
+
+
+module.exports = {
+  lz77,
+  rl,
+  diff16,
+};
@@ -1,6 +1,7 @@
 const fs = require('fs');
 const path = require('path');
 const { PNG } = require('pngjs');
+const compress = require('../compress.js');
 
 
 class ImageBuilder {
@@ -22,6 +23,11 @@ class ImageBuilder {
    * @property {string} destSize '<w>x<h>' (e.g. 128x128) or 'obj' (minimum obj size) or 'same' (same size)
    * @property {'normal' | 'renew' | 'renew_object'} paletteMode
    * @property {'normal' | 'renew' | 'ignore'} tileMode take effect only for BG tiles
+   * @property {Compression} mapCompression take effect only for BG maps (empty means 'none')
+   */
+
+  /**
+   * @typedef {'none' | 'lz77' | 'rl' | 'diff16lz77'} Compression
    */
 
   /**
@@ -105,7 +111,8 @@ class ImageBuilder {
     const strIndentInner = '  ' + strIndent;
 
     if (Array.isArray(cppVar.value)) {
-      let str = `${strIndent}constexpr std::array<${typeInfo.cppTypeName}, ${cppVar.value.length}> ${cppVar.name}{\n${strIndentInner}`;
+      // VRAM へは DMA3 や CpuFastSet で32bit単位でコピーするので4バイト境界に置く（app/CopyVRAM.hpp）
+      let str = `${strIndent}alignas(4) constexpr std::array<${typeInfo.cppTypeName}, ${cppVar.value.length}> ${cppVar.name}{\n${strIndentInner}`;
       for (let i = 0; i < cppVar.value.length; i++) {
         str += convertValue(cppVar.value[i]);
         str += i % 16 == 15 ? `,\n${strIndentInner}` : ', ';
@@ -117,6 +124,98 @@ class ImageBuilder {
     return `${strIndent}constexpr ${typeInfo.cppTypeName} ${cppVar.name} = ${cppVar.value};`;
   }
 
+  /**
+   * 配列の変数を圧縮したものに置き換える
+   * 圧縮したものは名前に形式（LZ77、RL、Diff16LZ77）を付けた u32 の配列になり、展開後のバイト数 <name>Bytes を添える
+   *
+   *   lz77        LZ77UnCompReadNormalWrite16bit で VRAM に直接展開できる
+   *   rl          RLUnCompReadNormalWrite16bit で VRAM に直接展開できる
+   *   diff16lz77  LZ77UnCompReadNormalWrite8bit で WRAM に展開してから Diff16bitUnFilter で戻す（連番の多いマップ向け）
+   * @param {CppVar} cppVar
+   * @param {Compression} compression
+   * @param {boolean} withBytes 圧縮しないときも <name>Bytes を出力する
+   * @returns {CppVar[]}
+   */
+  static compressVar(cppVar, compression, withBytes = false) {
+    const BYTES_PER_VALUE = {
+      u8: 1,
+      u16: 2,
+      u32: 4,
+    };
+
+    const bytesPerValue = BYTES_PER_VALUE[cppVar.type];
+    if (!bytesPerValue) {
+      throw new Error(`can not compress type: ${cppVar.type}`);
+    }
+
+    const data = Buffer.alloc(cppVar.value.length * bytesPerValue);
+    cppVar.value.forEach((value, index) => data.writeUIntLE(value, index * bytesPerValue, bytesPerValue));
+
+    const bytesVar = {
+      name: `${cppVar.name}Bytes`,
+      type: 'uint',
+      value: data.length,
+    };
+
+    /** @type {Buffer} */
+    let compressed;
+    let suffix;
+    switch (compression || 'none') {
+      case 'none':
+        return withBytes ? [cppVar, bytesVar] : [cppVar];
+
+      case 'lz77':
+        compressed = compress.lz77(data, { vram: true });
+        suffix = 'LZ77';
+        break;
+
+      case 'rl':
+        compressed = compress.rl(data);
+        suffix = 'RL';
+        break;
+
+      case 'diff16lz77':
+        compressed = compress.lz77(compress.diff16(data));
+        suffix = 'Diff16LZ77';
+        break;
+
+      default:
+        throw new Error(`unknown compression: ${compression}`);
+    }
+
+    const value = [];
+    for (let i = 0; i < compressed.length; i += 4) {
+      value.push(compressed.readUInt32LE(i));
+    }
+
+    return [
+      {
+        name: `${cppVar.name}${suffix}`,
+        type: 'u32',
+        value,
+      },
+      bytesVar,
+    ];
+  }
+
+  /**
+   * 8x8ブロック（calcBlock() の文字列）を反転
+   * @param {string} block
+   * @param {boolean} hflip
+   * @param {boolean} vflip
+   * @returns {string}
+   */
+  static flipBlock(block, hflip, vflip) {
+    let rows = block.match(/.{8}/g);
+    if (vflip) {
+      rows = rows.reverse();
+    }
+    if (hflip) {
+      rows = rows.map(row => Array.from(row).reverse().join(''));
+    }
+    return rows.join('');
+  }
+
   /**
    * GBAの15ビットRGBに変換
    * @param {number} r
@@ -326,7 +425,7 @@ class ImageBuilder {
     }
 
     // CSV列名
-    const keys = ['id', 'x', 'y', 'width', 'height', 'palette', 'destSize', 'paletteMode', 'tileMode'];
+    const keys = ['id', 'x', 'y', 'width', 'height', 'palette', 'destSize', 'paletteMode', 'tileMode', 'mapCompression'];
     // 数値のCSV列
     const numberKeyIndexSet = new Set(['x', 'y', 'palette'].map(key => keys.indexOf(key)));
 
@@ -396,8 +495,9 @@ class ImageBuilder {
    * @param {string} name
    * @param {string[]} pngPaths
    * @param {'bg' | 'obj'} type
+   * @param {{tileCompression?: Compression}} [options]
    */
-  constructor(name, pngPaths, type) {
+  constructor(name, pngPaths, type, options = {}) {
     this.name = name;
     this.paths = pngPaths.map(pngPath => ({
       pngPath: pngPath,
@@ -412,7 +512,12 @@ class ImageBuilder {
         /** @type {number} */
         this.nextTileIndex = 0;
 
+        /** @type {Set<string>} 反転したタイルを使い回したので追加しなかったタイル */
+        this.flippedTiles = new Set();
+
         /**
+         * 戻り値はマップのエントリ（タイル番号と反転のビット）
+         * force でなければ、同じタイルがなくても反転したものがあればそれを反転して使う
          * @param {string} tile
          * @param {boolean} force
          * @returns {number}
@@ -420,6 +525,15 @@ class ImageBuilder {
         this.tileToIndex = function tileToIndex(tile, force = false) {
           const nextTileIndex = this.nextTileIndex;
           const tileIndices = this.reverseTileMap.get(tile);
+          if (!tileIndices && !force) {
+            for (const { hflip, vflip, entry } of ImageBuilder.MAP_FLIPS) {
+              const flippedIndices = this.reverseTileMap.get(ImageBuilder.flipBlock(tile, hflip, vflip));
+              if (flippedIndices) {
+                this.flippedTiles.add(tile);
+                return flippedIndices[0] | entry;
+              }
+            }
+          }
           if (tileIndices) {
             if (force) {
               if (nextTileIndex >= ImageBuilder.MAX_TILES) {
@@ -504,14 +618,14 @@ class ImageBuilder {
               {
                 name: 'FirstTileIndex',
                 type: 'u16',
-                value: obj.map[0],
+                value: obj.map[0] & ImageBuilder.MAP_TILE_MASK,
               },
-              {
+              ...ImageBuilder.compressVar({
                 name: 'MapData',
                 type: 'u16',
                 // https://problemkaputt.de/gbatek.htm#lcdvrambgscreendataformatbgmap
-                value: obj.map.map(tileIndex => (obj.info.palette << 12) | tileIndex),
-              },
+                value: obj.map.map(entry => (obj.info.palette << 12) | entry),
+              }, obj.info.mapCompression),
             ]);
           }
           break;
@@ -599,6 +713,8 @@ class ImageBuilder {
             }
             return acc;
           }, new Array(this.nextTileIndex));
+
+        console.log(`${this.name}: ${this.nextTileIndex} tiles (${this.flippedTiles.size} tiles saved by flipping)`);
         break;
 
       case 'obj':
@@ -614,11 +730,11 @@ class ImageBuilder {
         type: 'u16',
         value: [].concat(...palettes),
       },
-      {
+      ...ImageBuilder.compressVar({
         name: 'TileData',
         type: 'u32',
         value: [].concat(...tiles.map(tile => ImageBuilder.tileDataToArray(tile))),
-      },
+      }, options.tileCompression, true),
     ];
 
     const perVarCode = this.objects.filter(obj => obj.info.id).map(obj => `
@@ -668,13 +784,35 @@ ImageBuilder.MAX_PALETTES = 16;
 ImageBuilder.MAX_COLORS_PER_PALETTE = 16;
 ImageBuilder.MAX_TILES = 1024;
 ImageBuilder.EMPTY_BLOCK = '0'.repeat(64);
+// https://problemkaputt.de/gbatek.htm#lcdvrambgscreendataformatbgmap
+ImageBuilder.MAP_TILE_MASK = 0x3FF;
+/** @type {{hflip: boolean, vflip: boolean, entry: number}[]} */
+ImageBuilder.MAP_FLIPS = [
+  { hflip: true, vflip: false, entry: 1 << 10 },
+  { hflip: false, vflip: true, entry: 1 << 11 },
+  { hflip: true, vflip: true, entry: (1 << 10) | (1 << 11) },
+];
 ImageBuilder.RESERVED_TILES_BG = 1;
 ImageBuilder.RESERVED_TILES_OBJ = 0;
 
 
-if (!process.argv[4]) {
-  console.log(`usage: node ${process.argv[1]} name [bg|obj] image1.png [image2.png [image3.png ...]]`);
+const args = process.argv.slice(2).filter(arg => !arg.startsWith('--'));
+const options = process.argv.slice(2).filter(arg => arg.startsWith('--')).reduce((acc, arg) => {
+  const [key, value] = arg.slice(2).split('=');
+  switch (key) {
+    case 'tile-compression':
+      acc.tileCompression = value;
+      break;
+
+    default:
+      throw new Error(`unknown option: ${arg}`);
+  }
+  return acc;
+}, {});
+
+if (!args[2]) {
+  console.log(`usage: node ${process.argv[1]} [--tile-compression=none|lz77|rl] name [bg|obj] image1.png [image2.png [image3.png ...]]`);
   process.exit(1);
 }
 
-new ImageBuilder(process.argv[2], process.argv.slice(4), process.argv[3]);
+new ImageBuilder(args[0], args.slice(2), args[1], options);